@@ -1,221 +1,111 @@
-// SixteenSegment16x24.c
-// Font type    : Full (95 characters)
-// Font size    : 16x24 pixels
-// Memory usage : 4564 bytes
+// SixteenSegment16x24 (из SixteenSegment16x24.h), матрицы построчно, младший бит - левая точка (BITS_RB)
+// 4560 байт матриц, сгенерировано tools/fontc
 
-#if defined(__AVR__)
-    #include <avr/pgmspace.h>
-    #define fontdatatype const uint8_t
-#elif defined(__PIC32MX__)
-    #define PROGMEM
-    #define fontdatatype const unsigned char
-#elif defined(__arm__)
-    #define PROGMEM
-    #define fontdatatype const unsigned char
-#endif
+#ifndef FONT_SIXTEEN_SEGMENT_16X24_H
+#define FONT_SIXTEEN_SEGMENT_16X24_H
 
-fontdatatype SixteenSegment16x24[4564] PROGMEM={
-// 0x10,0x18,0x20,0x5F,
-// 240 / 5 = 48 // 
-// 16 * 24 = 324 / 8
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // !
-0x00,0x00,0x3E,0x7C,0x1E,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // "
-0x00,0x00,0x3E,0x7C,0x3F,0xFC,0x41,0x82,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x41,0x82,0x3E,0x7C,0x3E,0x7C,0x41,0x82,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x41,0x82,0x3F,0xFC,0x3E,0x7C,0x00,0x00,  // #
-0x00,0x00,0x3E,0x7C,0x3F,0xF8,0x41,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x41,0x80,0x3E,0x7C,0x3E,0x7C,0x01,0x82,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x82,0x1F,0xFC,0x3E,0x7C,0x00,0x00,  // $
-0x00,0x00,0x3E,0x00,0x3F,0x00,0x41,0x88,0x61,0x88,0x61,0x98,0x61,0xB0,0x61,0xB0,0x61,0xE0,0x61,0xE0,0x41,0x80,0x3E,0x7C,0x3E,0x7C,0x01,0x82,0x07,0x86,0x07,0x86,0x0D,0x86,0x0D,0x86,0x19,0x86,0x11,0x86,0x11,0x82,0x00,0xFC,0x00,0x7C,0x00,0x00,  // %
-0x00,0x00,0x3E,0x00,0x3F,0x00,0x41,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x41,0x80,0x3F,0x00,0x3E,0x00,0x40,0x00,0x60,0x60,0x60,0x60,0x60,0x30,0x60,0x30,0x60,0x18,0x60,0x08,0x40,0x00,0x3E,0x78,0x3E,0x7C,0x00,0x00,  // &
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '
-0x00,0x00,0x00,0x7C,0x00,0x78,0x02,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x18,0x00,0x08,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x00,0x78,0x00,0x7C,0x00,0x00,  // (
-0x00,0x00,0x3E,0x00,0x1E,0x00,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x10,0x00,0x18,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x18,0x00,0x10,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0x40,0x1E,0x00,0x3E,0x00,0x00,0x00,  // )
-0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x88,0x11,0x88,0x19,0x98,0x0D,0xB0,0x0D,0xB0,0x07,0xE0,0x07,0xE0,0x01,0x80,0x3E,0x7C,0x3E,0x7C,0x01,0x80,0x07,0xE0,0x07,0xE0,0x0D,0xB0,0x0D,0xB0,0x19,0x98,0x11,0x88,0x11,0x88,0x00,0x00,0x00,0x00,0x00,0x00,  // *
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x3E,0x7C,0x3E,0x7C,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // +
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // -
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x00,0x00,  // .
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // /
+#include "lcd7735sl.h"
 
-0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x06,0x60,0x0E,0x60,0x1A,0x60,0x32,0x60,0x36,0x60,0x66,0x60,0x66,0x60,0x06,0x00,0x00,0x00,0x00,0x60,0x06,0x66,0x06,0x66,0x06,0x6C,0x06,0x4C,0x06,0x58,0x06,0x70,0x06,0x60,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x00,  // 0
-0x00,0x00,0x3E,0x00,0x1F,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x1F,0xF8,0x3E,0x7C,0x00,0x00,  // 1
-0x00,0x00,0x3E,0x7C,0x1E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x3E,0x7C,0x3E,0x7C,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x78,0x3E,0x7C,0x00,0x00,  // 2
-0x00,0x00,0x3E,0x7C,0x1E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x1E,0x7C,0x3E,0x7C,0x00,0x00,  // 3
-0x00,0x00,0x00,0x00,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x00,0x00,0x00,  // 4
-0x00,0x00,0x3E,0x7C,0x3E,0x78,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x7C,0x3E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x1E,0x7C,0x3E,0x7C,0x00,0x00,  // 5
-0x00,0x00,0x3E,0x7C,0x3E,0x78,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x00,  // 6
-0x00,0x00,0x3E,0x7C,0x1E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x00,0x00,0x00,  // 7
-0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x00,  // 8
-0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x1E,0x7C,0x3E,0x7C,0x00,0x00,  // 9
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // :
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ;
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0xC0,0x00,0xC0,0x01,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x00,0xC0,0x00,0xC0,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,  // <
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x78,0x3E,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // =
-0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x03,0x00,0x03,0x00,0x01,0x80,0x01,0x80,0x00,0xC0,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0xC0,0x01,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // >
-0x00,0x00,0x3E,0x7C,0x1E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x7C,0x00,0xFC,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // ?
-
-0x00,0x00,0x3E,0x7C,0x3F,0xFC,0x41,0x82,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x82,0x00,0xFC,0x00,0x7C,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x78,0x3E,0x7C,0x00,0x00,  // @
-0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x00,0x00,0x00,0x00,  // A
-0x00,0x00,0x3E,0x7C,0x1F,0xFC,0x01,0x82,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x82,0x3E,0x7C,0x3E,0x7C,0x01,0x82,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x82,0x1F,0xFC,0x3E,0x7C,0x00,0x00,  // B
-0x00,0x00,0x3E,0x7C,0x3E,0x78,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x78,0x3E,0x7C,0x00,0x00,  // C
-0x00,0x00,0x3E,0x7C,0x1F,0xFC,0x01,0x82,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x00,0x00,0x00,0x00,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x86,0x01,0x82,0x1F,0xFC,0x3E,0x7C,0x00,0x00,  // D
-0x00,0x00,0x3E,0x7C,0x3E,0x78,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x78,0x3E,0x7C,0x00,0x00,  // E
-0x00,0x00,0x3E,0x7C,0x3E,0x78,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x00,0x00,0x00,0x00,  // F
-0x00,0x00,0x3E,0x7C,0x3E,0x78,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x00,0x7C,0x00,0x7C,0x60,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x00,  // G
-0x00,0x00,0x00,0x00,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x00,0x00,0x00,0x00,  // H
-0x00,0x00,0x3E,0x7C,0x1F,0xF8,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x1F,0xF8,0x3E,0x7C,0x00,0x00,  // I
-0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x00,  // J
-0x00,0x00,0x00,0x00,0x40,0x00,0x60,0x08,0x60,0x08,0x60,0x18,0x60,0x30,0x60,0x30,0x60,0x60,0x60,0x60,0x40,0x00,0x3E,0x00,0x3E,0x00,0x40,0x00,0x60,0x60,0x60,0x60,0x60,0x30,0x60,0x30,0x60,0x18,0x60,0x08,0x60,0x08,0x40,0x00,0x00,0x00,0x00,0x00,  // K
-0x00,0x00,0x00,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x78,0x3E,0x7C,0x00,0x00,  // L
-0x00,0x00,0x00,0x00,0x40,0x02,0x60,0x06,0x70,0x0E,0x58,0x1A,0x4C,0x32,0x6C,0x36,0x66,0x66,0x66,0x66,0x60,0x06,0x00,0x00,0x00,0x00,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x40,0x02,0x00,0x00,0x00,0x00,  // M
-0x00,0x00,0x00,0x00,0x40,0x02,0x60,0x06,0x70,0x06,0x58,0x06,0x4C,0x06,0x6C,0x06,0x66,0x06,0x66,0x06,0x60,0x06,0x00,0x00,0x00,0x00,0x60,0x06,0x60,0x66,0x60,0x66,0x60,0x36,0x60,0x32,0x60,0x1A,0x60,0x0E,0x60,0x06,0x40,0x02,0x00,0x00,0x00,0x00,  // N
-0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x00,0x00,0x00,0x00,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x00,  // O
-
-0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x00,0x00,0x00,0x00,  // P
-0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x00,0x00,0x00,0x00,0x60,0x06,0x60,0x66,0x60,0x66,0x60,0x36,0x60,0x32,0x60,0x1A,0x60,0x0E,0x40,0x06,0x3E,0x7C,0x3E,0x7C,0x00,0x00,  // Q
-0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x06,0x3E,0x00,0x3E,0x00,0x40,0x00,0x60,0x60,0x60,0x60,0x60,0x30,0x60,0x30,0x60,0x18,0x60,0x08,0x60,0x08,0x40,0x00,0x00,0x00,0x00,0x00,  // R
-0x00,0x00,0x3E,0x7C,0x3E,0x78,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x7C,0x3E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x1E,0x7C,0x3E,0x7C,0x00,0x00,  // S
-0x00,0x00,0x3E,0x7C,0x1F,0xF8,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // T
-0x00,0x00,0x00,0x00,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x00,0x00,0x00,0x00,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x00,  // U
-0x00,0x00,0x00,0x00,0x40,0x00,0x60,0x08,0x60,0x08,0x60,0x18,0x60,0x30,0x60,0x30,0x60,0x60,0x60,0x60,0x60,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x66,0x00,0x66,0x00,0x6C,0x00,0x4C,0x00,0x58,0x00,0x70,0x00,0x60,0x00,0x40,0x00,0x00,0x00,0x00,0x00,  // V
-0x00,0x00,0x00,0x00,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x00,0x00,0x00,0x00,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x41,0x82,0x3F,0xFC,0x3E,0x7C,0x00,0x00,  // W
-0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x08,0x10,0x08,0x18,0x18,0x0C,0x30,0x0C,0x30,0x06,0x60,0x06,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x60,0x06,0x60,0x0C,0x30,0x0C,0x30,0x18,0x18,0x10,0x08,0x10,0x08,0x00,0x00,0x00,0x00,0x00,0x00,  // X
-0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x08,0x10,0x08,0x18,0x18,0x0C,0x30,0x0C,0x30,0x06,0x60,0x06,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // Y
-0x00,0x00,0x3E,0x7C,0x1E,0x78,0x00,0x00,0x00,0x08,0x00,0x18,0x00,0x30,0x00,0x30,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x10,0x00,0x00,0x00,0x1E,0x78,0x3E,0x7C,0x00,0x00,  // Z
-0x00,0x00,0x3E,0x00,0x3E,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x00,0x3E,0x00,0x00,0x00,  // [
-0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x18,0x00,0x0C,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x60,0x00,0x30,0x00,0x30,0x00,0x18,0x00,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,  // <backslash>
-0x00,0x00,0x00,0x7C,0x00,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x7C,0x00,0x7C,0x00,0x00,  // ]
-0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x40,0x06,0x60,0x06,0x60,0x0C,0x30,0x08,0x10,0x18,0x18,0x10,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ^
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x78,0x3E,0x7C,0x00,0x00,  // _
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x00,0x18,0x00,0x0C,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // `
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x03,0xC0,0x03,0xC0,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // a
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x07,0xE0,0x07,0xE0,0x0F,0xF0,0x0F,0xF0,0x07,0xE0,0x07,0xE0,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // b
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x1F,0xF8,0x3E,0x7C,0x00,0x00,  // c
-0x00,0x00,0x00,0x00,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x00,0x00,0x00,0x00,  // d
-0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x3E,0x7C,0x3E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x00,0x00,0x00,0x00,  // e
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x3F,0x00,0x41,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x41,0x80,0x3F,0x00,0x3E,0x00,0x00,0x00,  // f
-0x00,0x00,0x3E,0x00,0x3F,0x00,0x41,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x61,0x80,0x41,0x80,0x3F,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // g
-0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x00,0x00,0x00,0x00,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x00,0x00,0x00,0x00,  // h
-0x00,0x00,0x3E,0x7C,0x1E,0x7C,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x1E,0x7C,0x3E,0x7C,0x00,0x00,  // i
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x41,0x82,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x41,0x82,0x3F,0xFC,0x3E,0x7C,0x00,0x00,  // j
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x78,0x3E,0x7C,0x00,0x00,  // k
-0x00,0x00,0x3E,0x7C,0x1E,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // l
-0x00,0x00,0x3E,0x7C,0x1E,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x78,0x3E,0x7C,0x00,0x00,  // m
-0x00,0x00,0x3E,0x7C,0x1E,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // n
-0x00,0x00,0x3E,0x7C,0x1E,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x78,0x3E,0x7C,0x00,0x00,  // o
-
-0x00,0x00,0x3E,0x7C,0x1E,0x78,0x00,0x00,0x10,0x00,0x18,0x00,0x0C,0x00,0x0C,0x00,0x06,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x06,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x10,0x00,0x00,0x00,0x1E,0x78,0x3E,0x7C,0x00,0x00,  // p
-0x00,0x00,0x00,0x7C,0x00,0xF8,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x1F,0x00,0x3E,0x00,0x00,0x00,  // q
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x3E,0x7C,0x3E,0x7C,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x1F,0xF8,0x3E,0x7C,0x00,0x00,  // r
-0x00,0x00,0x00,0x00,0x40,0x02,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x60,0x06,0x40,0x02,0x3E,0x7C,0x3E,0x7C,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x00,0x00,0x00,0x00,  // s
-0x00,0x00,0x3E,0x7C,0x1E,0x78,0x00,0x00,0x10,0x08,0x18,0x18,0x0C,0x30,0x0C,0x30,0x06,0x60,0x06,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x60,0x06,0x60,0x0C,0x30,0x0C,0x30,0x18,0x18,0x10,0x08,0x00,0x00,0x1E,0x78,0x3E,0x7C,0x00,0x00,  // t
-0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x07,0xE0,0x07,0xE0,0x0D,0xB0,0x0D,0xB0,0x19,0x98,0x11,0x88,0x11,0x88,0x00,0x00,0x00,0x00,0x00,0x00,  // u
-0x00,0x00,0x00,0x00,0x00,0x00,0x11,0x88,0x11,0x88,0x19,0x98,0x0D,0xB0,0x0D,0xB0,0x07,0xE0,0x07,0xE0,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x00,0x00,  // v
-0x00,0x00,0x00,0x00,0x40,0x02,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x41,0x82,0x3E,0x7C,0x3E,0x7C,0x41,0x82,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x61,0x86,0x40,0x02,0x00,0x00,0x00,0x00,  // w
-0x00,0x00,0x3E,0x7C,0x1F,0xF8,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x3E,0x7C,0x3E,0x7C,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x1F,0xF8,0x3E,0x7C,0x00,0x00,  // x
-0x00,0x00,0x3E,0x7C,0x3E,0x7C,0x60,0x06,0x70,0x0E,0x58,0x1A,0x4C,0x32,0x6C,0x36,0x66,0x66,0x66,0x66,0x60,0x06,0x00,0x00,0x00,0x00,0x60,0x06,0x66,0x66,0x66,0x66,0x6C,0x36,0x4C,0x32,0x58,0x1A,0x70,0x0E,0x60,0x06,0x3E,0x7C,0x3E,0x7C,0x00,0x00,  // y
-0x00,0x00,0x3E,0x7C,0x3F,0xFC,0x61,0x86,0x71,0x8E,0x59,0x9A,0x4D,0xB2,0x6D,0xB6,0x67,0xE6,0x67,0xE6,0x41,0x82,0x3E,0x7C,0x3E,0x7C,0x41,0x82,0x67,0xE6,0x67,0xE6,0x6D,0xB6,0x4D,0xB2,0x59,0x9A,0x71,0x8E,0x61,0x86,0x3F,0xFC,0x3E,0x7C,0x00,0x00,  // z
-0x00,0x00,0x00,0x7C,0x00,0xF8,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x3E,0x00,0x3E,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0xF8,0x00,0x7C,0x00,0x00,  // {
-0x00,0x00,0x3E,0x00,0x1F,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x00,0x00,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0xF8,0x00,0x7C,0x00,0x00,  // |
-0x00,0x00,0x3E,0x00,0x1F,0x00,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x00,0x7C,0x00,0x7C,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x01,0x80,0x1F,0x00,0x3E,0x00,0x00,0x00,  // }
-0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x06,0x00,0x02,0x3E,0x7C,0x3E,0x7C,0x40,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x60,0x00,0x40,0x00,0x00,0x00,0x00,0x00,  // ~
+const unsigned char font_sixteen_segment_16x24[4560] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 32 < >
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 33 <!>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 34 <">
+    0x00, 0x00, 0x7C, 0x3E, 0xFC, 0x3F, 0x82, 0x41, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x82, 0x41, 0x7C, 0x3E, 0x7C, 0x3E, 0x82, 0x41, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x82, 0x41, 0xFC, 0x3F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 35 <#>
+    0x00, 0x00, 0x7C, 0x3E, 0xFC, 0x1F, 0x82, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x82, 0x01, 0x7C, 0x3E, 0x7C, 0x3E, 0x80, 0x41, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x41, 0xF8, 0x3F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 36 <$>
+    0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x82, 0x11, 0x86, 0x11, 0x86, 0x19, 0x86, 0x0D, 0x86, 0x0D, 0x86, 0x07, 0x86, 0x07, 0x82, 0x01, 0x7C, 0x3E, 0x7C, 0x3E, 0x80, 0x41, 0xE0, 0x61, 0xE0, 0x61, 0xB0, 0x61, 0xB0, 0x61, 0x98, 0x61, 0x88, 0x61, 0x88, 0x41, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x00,  // Символ 37 <%>
+    0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x82, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x82, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0x02, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x18, 0x06, 0x10, 0x02, 0x00, 0x7C, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 38 <&>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 39 <'>
+    0x00, 0x00, 0x00, 0x3E, 0x00, 0x1E, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x10, 0x00, 0x18, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x10, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x00,  // Символ 40 <(>
+    0x00, 0x00, 0x7C, 0x00, 0x78, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x18, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x78, 0x00, 0x7C, 0x00, 0x00, 0x00,  // Символ 41 <)>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x11, 0x88, 0x11, 0x98, 0x19, 0xB0, 0x0D, 0xB0, 0x0D, 0xE0, 0x07, 0xE0, 0x07, 0x80, 0x01, 0x7C, 0x3E, 0x7C, 0x3E, 0x80, 0x01, 0xE0, 0x07, 0xE0, 0x07, 0xB0, 0x0D, 0xB0, 0x0D, 0x98, 0x19, 0x88, 0x11, 0x88, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 42 <*>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x7C, 0x3E, 0x7C, 0x3E, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 43 <+>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 44 <,>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 45 <->
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00,  // Символ 46 <.>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x10, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 47 </>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x60, 0x06, 0x70, 0x06, 0x58, 0x06, 0x4C, 0x06, 0x6C, 0x06, 0x66, 0x06, 0x66, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x66, 0x60, 0x66, 0x60, 0x36, 0x60, 0x32, 0x60, 0x1A, 0x60, 0x0E, 0x60, 0x06, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 48 <0>
+    0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xF8, 0x1F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 49 <1>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 50 <2>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x78, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 51 <3>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,  // Символ 52 <4>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x1E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x78, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 53 <5>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x1E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 54 <6>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,  // Символ 55 <7>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 56 <8>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x78, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 57 <9>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 58 <:>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 59 <;>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 60 <<>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1E, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 61 <=>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 62 <>>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x3F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 63 <?>
+    0x00, 0x00, 0x7C, 0x3E, 0xFC, 0x3F, 0x82, 0x41, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x41, 0x00, 0x3F, 0x00, 0x3E, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 64 <@>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,  // Символ 65 <A>
+    0x00, 0x00, 0x7C, 0x3E, 0xF8, 0x3F, 0x80, 0x41, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x41, 0x7C, 0x3E, 0x7C, 0x3E, 0x80, 0x41, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x41, 0xF8, 0x3F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 66 <B>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x1E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 67 <C>
+    0x00, 0x00, 0x7C, 0x3E, 0xF8, 0x3F, 0x80, 0x41, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x00, 0x00, 0x00, 0x00, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x61, 0x80, 0x41, 0xF8, 0x3F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 68 <D>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x1E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 69 <E>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x1E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 70 <F>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x1E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x06, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 71 <G>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,  // Символ 72 <H>
+    0x00, 0x00, 0x7C, 0x3E, 0xF8, 0x1F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xF8, 0x1F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 73 <I>
+    0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 74 <J>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x10, 0x06, 0x10, 0x06, 0x18, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x02, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x02, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x18, 0x06, 0x10, 0x06, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 75 <K>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 76 <L>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x60, 0x0E, 0x70, 0x1A, 0x58, 0x32, 0x4C, 0x36, 0x6C, 0x66, 0x66, 0x66, 0x66, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,  // Символ 77 <M>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x60, 0x0E, 0x60, 0x1A, 0x60, 0x32, 0x60, 0x36, 0x60, 0x66, 0x60, 0x66, 0x60, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x06, 0x66, 0x06, 0x66, 0x06, 0x6C, 0x06, 0x4C, 0x06, 0x58, 0x06, 0x70, 0x06, 0x60, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,  // Символ 78 <N>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 79 <O>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 80 <P>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x06, 0x66, 0x06, 0x66, 0x06, 0x6C, 0x06, 0x4C, 0x06, 0x58, 0x06, 0x70, 0x02, 0x60, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 81 <Q>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x60, 0x7C, 0x00, 0x7C, 0x00, 0x02, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x18, 0x06, 0x10, 0x06, 0x10, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 82 <R>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x1E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x78, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 83 <S>
+    0x00, 0x00, 0x7C, 0x3E, 0xF8, 0x1F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 84 <T>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 85 <U>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x10, 0x06, 0x10, 0x06, 0x18, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x66, 0x00, 0x66, 0x00, 0x36, 0x00, 0x32, 0x00, 0x1A, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 86 <V>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x82, 0x41, 0xFC, 0x3F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 87 <W>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x08, 0x10, 0x18, 0x18, 0x30, 0x0C, 0x30, 0x0C, 0x60, 0x06, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x60, 0x06, 0x30, 0x0C, 0x30, 0x0C, 0x18, 0x18, 0x08, 0x10, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 88 <X>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x10, 0x08, 0x10, 0x18, 0x18, 0x30, 0x0C, 0x30, 0x0C, 0x60, 0x06, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 89 <Y>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x1E, 0x00, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x08, 0x00, 0x00, 0x00, 0x78, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 90 <Z>
+    0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x00, 0x00,  // Символ 91 <[>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x10, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 92 <\>
+    0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00,  // Символ 93 <]>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x60, 0x06, 0x60, 0x06, 0x30, 0x0C, 0x10, 0x08, 0x18, 0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 94 <^>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 95 <_>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 96 <`>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xC0, 0x03, 0xC0, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 97 <a>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xE0, 0x07, 0xE0, 0x07, 0xF0, 0x0F, 0xF0, 0x0F, 0xE0, 0x07, 0xE0, 0x07, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 98 <b>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xF8, 0x1F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 99 <c>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 100 <d>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,  // Символ 101 <e>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x82, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x82, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0x00,  // Символ 102 <f>
+    0x00, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0x82, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0x82, 0x01, 0xFC, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 103 <g>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,  // Символ 104 <h>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x3E, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x78, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 105 <i>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x82, 0x41, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x82, 0x41, 0xFC, 0x3F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 106 <j>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 107 <k>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 108 <l>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 109 <m>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 110 <n>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 111 <o>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x1E, 0x00, 0x00, 0x08, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x08, 0x00, 0x00, 0x00, 0x78, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 112 <p>
+    0x00, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00,  // Символ 113 <q>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x7C, 0x3E, 0x7C, 0x3E, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xF8, 0x1F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 114 <r>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x06, 0x60, 0x02, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 115 <s>
+    0x00, 0x00, 0x7C, 0x3E, 0x78, 0x1E, 0x00, 0x00, 0x08, 0x10, 0x18, 0x18, 0x30, 0x0C, 0x30, 0x0C, 0x60, 0x06, 0x60, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x06, 0x60, 0x06, 0x30, 0x0C, 0x30, 0x0C, 0x18, 0x18, 0x08, 0x10, 0x00, 0x00, 0x78, 0x1E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 116 <t>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0xE0, 0x07, 0xE0, 0x07, 0xB0, 0x0D, 0xB0, 0x0D, 0x98, 0x19, 0x88, 0x11, 0x88, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 117 <u>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x11, 0x88, 0x11, 0x98, 0x19, 0xB0, 0x0D, 0xB0, 0x0D, 0xE0, 0x07, 0xE0, 0x07, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 118 <v>
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x82, 0x41, 0x7C, 0x3E, 0x7C, 0x3E, 0x82, 0x41, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x86, 0x61, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00,  // Символ 119 <w>
+    0x00, 0x00, 0x7C, 0x3E, 0xF8, 0x1F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x7C, 0x3E, 0x7C, 0x3E, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xF8, 0x1F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 120 <x>
+    0x00, 0x00, 0x7C, 0x3E, 0x7C, 0x3E, 0x06, 0x60, 0x0E, 0x70, 0x1A, 0x58, 0x32, 0x4C, 0x36, 0x6C, 0x66, 0x66, 0x66, 0x66, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0x60, 0x66, 0x66, 0x66, 0x66, 0x36, 0x6C, 0x32, 0x4C, 0x1A, 0x58, 0x0E, 0x70, 0x06, 0x60, 0x7C, 0x3E, 0x7C, 0x3E, 0x00, 0x00,  // Символ 121 <y>
+    0x00, 0x00, 0x7C, 0x3E, 0xFC, 0x3F, 0x86, 0x61, 0x8E, 0x71, 0x9A, 0x59, 0xB2, 0x4D, 0xB6, 0x6D, 0xE6, 0x67, 0xE6, 0x67, 0x82, 0x41, 0x7C, 0x3E, 0x7C, 0x3E, 0x82, 0x41, 0xE6, 0x67, 0xE6, 0x67, 0xB6, 0x6D, 0xB2, 0x4D, 0x9A, 0x59, 0x8E, 0x71, 0x86, 0x61, 0xFC, 0x3F, 0x7C, 0x3E, 0x00, 0x00,  // Символ 122 <z>
+    0x00, 0x00, 0x00, 0x3E, 0x00, 0x1F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x7C, 0x00, 0x7C, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00,  // Символ 123 <{>
+    0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x00,  // Символ 124 <|>
+    0x00, 0x00, 0x7C, 0x00, 0xF8, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x3E, 0x00, 0x3E, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xF8, 0x00, 0x7C, 0x00, 0x00, 0x00,  // Символ 125 <}>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x40, 0x7C, 0x3E, 0x7C, 0x3E, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00   // Символ 126 <~>
 };
 
+// описание шрифта для print_char_font()
+const st7735_font fd_sixteen_segment_16x24 = { font_sixteen_segment_16x24, 0, 48, 16, 24, 32, 95, BITS_RB, 0 };
 
-const unsigned int SixteenSegment16x24dx[255] = {
-48	,	 //  space (32)
-96	,	 //  33 '!'
-144	,	 //  34
-192	,	 //  35
-240	,	 //  36
-288	,	 //  37
-336	,	 //  38
-384	,	 //  39
-432	,	 //  40
-480	,	 //  41
-528	,	 //  42
-576	,	 //  43
-624	,	 //  44
-672	,	 //  45
-720	,	 //  46 '.'
-768	,	 //  47
-816	,	 //  48 '0'
-864	,	 //  49 '1'
-912	,	 //  50 '2'
-960	,	 //  51 '3'
-1008	,	 //  52 '4'
-1056	,	 //  53 '5'
-1104	,	 //  54 '6'
-1152	,	 //  55 '7'
-1200	,	 //  56 '8'
-1248	,	 //  57 '9'
-1296	,	 //  58 ':'
-1344	,	 //  59
-1392	,	 //  60
-1440	,	 //  61
-1488	,	 //  62
-1536	,	 //  63
-1584	,	 //  64
-1632	,	 //  65
-1680	,	 //  66
-1728	,	 //  67
-1776	,	 //  68
-1824	,	 //  69
-1872	,	 //  70
-1920	,	 //  71
-1968	,	 //  72
-2016	,	 //  73
-2064	,	 //  74
-2112	,	 //  75
-2160	,	 //  76
-2208	,	 //  77
-2256	,	 //  78
-2304	,	 //  79
-2352	,	 //  80
-2400	,	 //  81
-2448	,	 //  82
-2496	,	 //  83
-2544	,	 //  84
-2592	,	 //  85
-2640	,	 //  86
-2688	,	 //  87
-2736	,	 //  88
-2784	,	 //  89
-2832	,	 //  90
-2880	,	 //  91
-2928	,	 //  92
-2976	,	 //  93
-3024	,	 //  94
-3072	,	 //  95
-3120	,	 //  96
-3168	,	 //  97
-3216	,	 //  98
-3264	,	 //  99
-3312	,	 // 100
-3360	,	 // 101
-3408	,	 // 102
-3456	,	 // 103
-3504	,	 // 104
-3552	,	 // 105
-3600	,	 // 106
-3648	,	 // 107
-3696	,	 // 108
-3744	,	 // 109
-3792	,	 // 110
-3840	,	 // 111
-3888	,	 // 112
-3936	,	 // 113
-3984	,	 // 114
-4032	,	 // 115
-4080	,	 // 116
-4128	,	 // 117
-4176	,	 // 118
-4224	,	 // 119
-4272	,	 // 120
-4320	,	 // 121
-4368	,	 // 122
-4416	,	 // 123
-4464	,	 // 124
-4512	,	 // 125
-4560	,	 // 126
-
-};
\ No newline at end of file
+#endif // FONT_SIXTEEN_SEGMENT_16X24_H
@@ -0,0 +1,141 @@
+#include "bargraph.h"
+
+// длина полосы в точках вдоль роста
+static uint8_t bargraph_len(const bargraph *b)
+{
+  return (b->flags & BG_VERT) ? b->H : b->W;
+}
+
+uint8_t bargraph_level(const bargraph *b, int32_t value)
+{
+  uint32_t units = b->segs ? b->segs : bargraph_len(b);
+  uint32_t v = value, m = b->max;
+  if (value <= 0)     return 0;
+  if (value >= b->max) return units;
+  while (m > 0xFFFFFF) { m >>= 1; v >>= 1; } // units до 255: произведение не выйдет за 32 бита
+  return units * v / m;
+}
+
+// точки a..e-1 вдоль полосы одной заливкой, возвращает число точек
+static uint16_t bargraph_fill(const bargraph *b, uint8_t a, uint8_t e, uint16_t color)
+{
+  if (a >= e) return 0;
+  if (b->flags & BG_VERT) {
+    st7735fillrect_dma(b->X, b->Y + b->H - e, b->X + b->W - 1, b->Y + b->H - a - 1, color, 0);
+    return (e - a) * b->W;
+  }
+  st7735fillrect_dma(b->X + a, b->Y, b->X + e - 1, b->Y + b->H - 1, color, 0);
+  return (e - a) * b->H;
+}
+
+// точки (сегменты) a..e-1 зажечь (lit = 1) или погасить
+static uint16_t bargraph_span(const bargraph *b, uint8_t a, uint8_t e, uint8_t lit)
+{
+  uint16_t sent = 0;
+  uint8_t  m, s;
+  if (!b->segs) {
+    if (!lit) return bargraph_fill(b, a, e, b->off);
+    m = (e < b->zone) ? e : b->zone; // граница зоны внутри отрезка - две заливки
+    if (a < m) sent += bargraph_fill(b, a, m, b->on);
+    else       m = a;
+    return sent + bargraph_fill(b, m, e, b->hot);
+  }
+  for (; a < e; a++) {
+    s = a * (b->seglen + b->gap);
+    sent += bargraph_fill(b, s, s + b->seglen, !lit ? b->off : (a >= b->zone) ? b->hot : b->on);
+  }
+  return sent;
+}
+
+// всё заново: рамка, сегменты и зазоры между ними
+static uint16_t bargraph_draw(bargraph *b, uint8_t n)
+{
+  uint16_t sent = 0;
+  uint8_t  i, s, L = bargraph_len(b);
+  if (b->flags & BG_FRAME) {
+    st7735rect(b->X - 2, b->Y - 2, b->X + b->W + 1, b->Y + b->H + 1, b->on);
+    st7735rect(b->X - 1, b->Y - 1, b->X + b->W, b->Y + b->H, b->bg);
+  }
+  if (!b->segs) return bargraph_span(b, 0, n, 1) + bargraph_span(b, n, L, 0);
+  for (i = 0; i < b->segs; i++) {
+    s = i * (b->seglen + b->gap);
+    sent += bargraph_span(b, i, i + 1, i < n);
+    sent += bargraph_fill(b, s + b->seglen, (i + 1 < b->segs) ? s + b->seglen + b->gap : L, b->bg); // зазор или остаток
+  }
+  return sent;
+}
+
+void bargraph_init(bargraph *b, unsigned char X, unsigned char Y, unsigned char W, unsigned char H,
+                   uint8_t flags, int32_t max, uint16_t on, uint16_t off, uint16_t bg)
+{
+  if (W < 5 || H < 5) flags &= ~BG_FRAME; // рамке с зазором нужно 4 точки, полосе - хоть одна
+  if (flags & BG_FRAME) {                  // полоса внутри рамки и зазора
+    X += 2; Y += 2;
+    W -= 4; H -= 4;
+  }
+  b->X     = X;
+  b->Y     = Y;
+  b->W     = W;
+  b->H     = H;
+  b->flags = flags;
+  b->max   = (max > 0) ? max : 1;
+  b->segs  = 0;
+  b->gap   = 0;
+  b->zone  = 255;
+  b->shown = 0;
+  b->on    = on;
+  b->off   = off;
+  b->hot   = on;
+  b->bg    = bg;
+  b->valid = 0;
+}
+
+void bargraph_segments(bargraph *b, uint8_t segs, uint8_t gap)
+{
+  uint8_t L = bargraph_len(b);
+  b->segs = 0;
+  b->gap  = 0;
+  if (segs && (segs - 1) * gap < L && (L - (segs - 1) * gap) / segs) { // сегмент хотя бы в точку
+    b->segs   = segs;
+    b->gap    = gap;
+    b->seglen = (L - (segs - 1) * gap) / segs;
+  }
+  b->valid = 0;
+}
+
+void bargraph_zone(bargraph *b, uint8_t from, uint16_t hot)
+{
+  b->zone  = from;
+  b->hot   = hot;
+  b->valid = 0;
+}
+
+void bargraph_colors(bargraph *b, uint16_t on, uint16_t off, uint16_t bg)
+{
+  b->on    = on;
+  b->off   = off;
+  b->bg    = bg;
+  b->valid = 0;
+}
+
+void bargraph_invalidate(bargraph *b)
+{
+  b->valid = 0;
+}
+
+uint16_t bargraph_set(bargraph *b, int32_t value)
+{
+  uint8_t  n = bargraph_level(b, value);
+  uint16_t sent;
+
+  if (!b->valid) {
+    b->valid = 1;
+    b->shown = n;
+    return bargraph_draw(b, n);
+  }
+  if (n == b->shown) return 0; // на экране уже это
+  // выросло - зажигаем прибавку, убыло - гасим убыль
+  sent = (n > b->shown) ? bargraph_span(b, b->shown, n, 1) : bargraph_span(b, n, b->shown, 0);
+  b->shown = n;
+  return sent;
+}
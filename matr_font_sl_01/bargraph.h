@@ -0,0 +1,44 @@
+#pragma once
+#ifndef __BARGRAPH_H__
+#define __BARGRAPH_H__
+#include "lcd7735sl.h"
+
+// Полоса уровня и прогресс без перерисовки целиком: на экране хранится, сколько точек
+// (у сегментной полосы - сегментов) горит, и при смене значения заливается только разница -
+// выросшая часть цветом on, убывшая цветом off. Сплошная полоса растёт слева направо
+// (BG_VERT - снизу вверх), сегментная ("светодиодная") - так же, по целым сегментам.
+
+#define BG_VERT  0x01 // вертикальная, растёт снизу вверх
+#define BG_FRAME 0x02 // прогресс: рамка цветом on и зазор в точку цветом bg вокруг полосы
+
+typedef struct {
+  unsigned char X, Y, W, H; // сама полоса (внутри рамки, если BG_FRAME)
+  uint8_t  flags;           // BG_*
+  uint8_t  segs;            // 0 - сплошная, иначе число сегментов
+  uint8_t  gap;             // зазор между сегментами в точках
+  uint8_t  seglen;          // длина сегмента в точках
+  uint8_t  zone;            // с этой точки (сегмента) горящая часть цвета hot, 255 - зоны нет
+  uint8_t  shown;           // сколько точек (сегментов) горит на экране
+  uint8_t  valid;           // 0 - что на экране, не известно: следующий вывод рисует всё
+  uint16_t on, off, hot, bg; // горящая часть, погасшая, зона, зазоры и поле рамки
+  int32_t  max;             // значение полной полосы
+} bargraph;
+
+// X, Y, W, H - место на экране вместе с рамкой (меньше 5 x 5 - рамки нет); max - значение полной полосы,
+// 1..INT32_MAX (не больше нуля - считается 1)
+void bargraph_init(bargraph *b, unsigned char X, unsigned char Y, unsigned char W, unsigned char H,
+                   uint8_t flags, int32_t max, uint16_t on, uint16_t off, uint16_t bg);
+// сегментная полоса: segs сегментов с зазором gap (0 - снова сплошная)
+void bargraph_segments(bargraph *b, uint8_t segs, uint8_t gap);
+// горящие точки (сегменты) начиная с from - цвета hot (красная зона индикатора), from = 255 - без зоны
+void bargraph_zone(bargraph *b, uint8_t from, uint16_t hot);
+// цвета сменились или экран очищен - следующий вывод рисует всё
+void bargraph_colors(bargraph *b, uint16_t on, uint16_t off, uint16_t bg);
+void bargraph_invalidate(bargraph *b);
+// новое значение - любое int32_t, обрезается до 0..max; возвращает число залитых точек
+uint16_t bargraph_set(bargraph *b, int32_t value);
+// сколько точек (у сегментной полосы - сегментов) горит при value (любое int32_t, как у bargraph_set),
+// на экран ничего не выводится
+uint8_t bargraph_level(const bargraph *b, int32_t value);
+
+#endif // __BARGRAPH_H__
@@ -0,0 +1,111 @@
+// Consolas 22 (из consolas_22_font.h), сглаженный, 2 бита на точку (BITS_G2)
+// 4845 байт матриц, сгенерировано tools/fontc
+
+#ifndef FONT_CONSOLAS_11_G2_H
+#define FONT_CONSOLAS_11_G2_H
+
+#include "lcd7735sl.h"
+
+const unsigned char font_consolas_11_g2[4845] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 32 < >
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x90, 0x00, 0x00, 0x50, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 33 <!>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x00, 0x00, 0xEB, 0x00, 0x00, 0xEB, 0x00, 0x00, 0xEB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 34 <">
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xB0, 0x00, 0x0A, 0xB0, 0x00, 0x6A, 0xB9, 0x00, 0x6E, 0xE9, 0x00, 0x0E, 0xE0, 0x00, 0x0C, 0xE0, 0x00, 0xFF, 0xFC, 0x00, 0x1D, 0xD0, 0x00, 0x2E, 0xC0, 0x00, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 35 <#>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x80, 0x00, 0x0A, 0x90, 0x00, 0x7B, 0xA0, 0x00, 0xE3, 0x00, 0x00, 0xE3, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x0A, 0xE0, 0x00, 0x0A, 0x78, 0x00, 0x0A, 0x38, 0x00, 0xAA, 0xA0, 0x00, 0x2E, 0x40, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 36 <$>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x05, 0x00, 0x7A, 0x9C, 0x00, 0xB2, 0xE4, 0x00, 0x7A, 0xE0, 0x00, 0x1A, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x06, 0x29, 0x00, 0x0D, 0xAB, 0x40, 0x28, 0xE3, 0x80, 0x60, 0xAB, 0x40, 0x90, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 37 <%>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x80, 0x00, 0x2E, 0xE0, 0x00, 0x38, 0xB0, 0x00, 0x38, 0xA0, 0x00, 0x2E, 0x80, 0x00, 0x2E, 0x18, 0x00, 0xA3, 0xAC, 0x00, 0xE1, 0xE8, 0x00, 0xE0, 0xB4, 0x00, 0xBA, 0xE8, 0x00, 0x1A, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 38 <&>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 39 <'>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x0A, 0x00, 0x00, 0x28, 0x00, 0x00, 0x74, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x01, 0x00, 0x00,  // Символ 40 <(>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x74, 0x00, 0x00, 0x28, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x38, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x40, 0x00, 0x00,  // Символ 41 <)>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x4A, 0x10, 0x00, 0xAA, 0xA0, 0x00, 0x0F, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0x4A, 0x10, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 42 <*>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0xFF, 0xFE, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 43 <+>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 44 <,>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 45 <->
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 46 <.>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xD0, 0x00, 0x01, 0xC0, 0x00, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x28, 0x00, 0x00, 0x34, 0x00, 0x00, 0x60, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 47 </>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xD0, 0x00, 0x74, 0x74, 0x00, 0xA0, 0x38, 0x00, 0xE0, 0xAC, 0x00, 0xE2, 0x6C, 0x00, 0xE9, 0x2C, 0x00, 0xF4, 0x2C, 0x00, 0xB0, 0x38, 0x00, 0x2A, 0xA0, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 48 <0>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x80, 0x00, 0xB7, 0x80, 0x00, 0x43, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x03, 0x80, 0x00, 0x6B, 0xA4, 0x00, 0x6A, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 49 <1>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x40, 0x00, 0x91, 0xD0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x02, 0xC0, 0x00, 0x07, 0x40, 0x00, 0x1D, 0x00, 0x00, 0x74, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 50 <2>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x41, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x02, 0xD0, 0x00, 0x3F, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xA0, 0x00, 0xAA, 0xD0, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 51 <3>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x00, 0x03, 0xB0, 0x00, 0x0A, 0xB0, 0x00, 0x1C, 0xB0, 0x00, 0x28, 0xB0, 0x00, 0x60, 0xB0, 0x00, 0xEA, 0xB9, 0x00, 0xAA, 0xB9, 0x00, 0x00, 0xB0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 52 <4>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x01, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xA0, 0x00, 0xAA, 0x90, 0x00, 0xA9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 53 <5>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF0, 0x00, 0x29, 0x00, 0x00, 0xB0, 0x00, 0x00, 0xEA, 0x80, 0x00, 0xFA, 0xB0, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xB0, 0x74, 0x00, 0x7A, 0xE0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 54 <6>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x34, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xD0, 0x00, 0x02, 0x80, 0x00, 0x03, 0x40, 0x00, 0x0B, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 55 <7>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0xA0, 0x78, 0x00, 0xE0, 0x38, 0x00, 0xB8, 0xA0, 0x00, 0x2F, 0xC0, 0x00, 0x75, 0xA0, 0x00, 0xE0, 0x78, 0x00, 0xE0, 0x38, 0x00, 0xBA, 0xA0, 0x00, 0x1A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 56 <8>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x90, 0x00, 0xB4, 0xB0, 0x00, 0xE0, 0x74, 0x00, 0xE0, 0x38, 0x00, 0xA0, 0x78, 0x00, 0x6F, 0xB8, 0x00, 0x00, 0x74, 0x00, 0x00, 0xA0, 0x00, 0x6B, 0x80, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 57 <9>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 58 <:>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x2E, 0x00, 0x00, 0x2D, 0x00, 0x00, 0xE4, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 59 <;>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x02, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x74, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x74, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x02, 0x80, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 60 <<>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 61 <=>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x2D, 0x00, 0x00, 0x07, 0x40, 0x00, 0x02, 0xC0, 0x00, 0x07, 0x40, 0x00, 0x2D, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 62 <>>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0xAD, 0x00, 0x00, 0x07, 0x40, 0x00, 0x03, 0x80, 0x00, 0x07, 0x80, 0x00, 0x3E, 0x00, 0x00, 0x38, 0x00, 0x00, 0x24, 0x00, 0x00, 0x20, 0x00, 0x00, 0xB8, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 63 <?>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xA0, 0x00, 0x0A, 0xA8, 0x00, 0x28, 0x0A, 0x00, 0x30, 0x07, 0x00, 0xA2, 0xF3, 0x00, 0x9A, 0xB3, 0x00, 0xCE, 0xA3, 0x00, 0xCE, 0xA3, 0x00, 0xCE, 0xAA, 0x00, 0xCB, 0xB8, 0x00, 0x90, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x2A, 0xA0, 0x00, 0x0A, 0x80, 0x00,  // Символ 64 <@>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x0A, 0xC0, 0x00, 0x0D, 0xA0, 0x00, 0x1C, 0xA0, 0x00, 0x28, 0x30, 0x00, 0x34, 0x38, 0x00, 0x7A, 0xA8, 0x00, 0xAA, 0xAC, 0x00, 0xE0, 0x0E, 0x00, 0x80, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 65 <A>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xE1, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE1, 0xD0, 0x00, 0xFF, 0x80, 0x00, 0xE1, 0xA0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xEA, 0xD0, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 66 <B>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xF4, 0x00, 0x38, 0x04, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2E, 0xA8, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 67 <C>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0xE0, 0xB4, 0x00, 0xE0, 0x28, 0x00, 0xE0, 0x2C, 0x00, 0xE0, 0x2C, 0x00, 0xE0, 0x2C, 0x00, 0xE0, 0x28, 0x00, 0xE0, 0x74, 0x00, 0xEA, 0xE0, 0x00, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 68 <D>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xEA, 0x90, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 69 <E>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xEA, 0x80, 0x00, 0xEA, 0x80, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 70 <F>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xF8, 0x00, 0x29, 0x04, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE1, 0xA8, 0x00, 0xE1, 0xAC, 0x00, 0xA0, 0x2C, 0x00, 0xB4, 0x2C, 0x00, 0x2E, 0xAC, 0x00, 0x06, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 71 <G>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xFF, 0xF0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 72 <H>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xAE, 0x90, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 73 <I>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0xAB, 0x40, 0x00, 0x69, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 74 <J>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x74, 0x00, 0xE1, 0xD0, 0x00, 0xE2, 0x80, 0x00, 0xEA, 0x00, 0x00, 0xEC, 0x00, 0x00, 0xED, 0x00, 0x00, 0xE7, 0x40, 0x00, 0xE2, 0xC0, 0x00, 0xE0, 0xA0, 0x00, 0x90, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 75 <K>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xEA, 0x90, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 76 <L>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0x3C, 0x00, 0xA4, 0x6C, 0x00, 0xE8, 0x9C, 0x00, 0xCC, 0xCC, 0x00, 0xCA, 0x8C, 0x00, 0xC7, 0x4C, 0x00, 0xC2, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0xC0, 0x0C, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 77 <M>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xB0, 0x00, 0xF8, 0xB0, 0x00, 0xE8, 0xB0, 0x00, 0xEC, 0xB0, 0x00, 0xEA, 0xB0, 0x00, 0xE6, 0xB0, 0x00, 0xE3, 0xB0, 0x00, 0xE2, 0xF0, 0x00, 0xE1, 0xF0, 0x00, 0x90, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 78 <N>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x74, 0x74, 0x00, 0xA0, 0x28, 0x00, 0xE0, 0x2C, 0x00, 0xE0, 0x2C, 0x00, 0xE0, 0x2C, 0x00, 0xE0, 0x28, 0x00, 0xB0, 0x38, 0x00, 0x2A, 0xA0, 0x00, 0x0A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 79 <O>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x90, 0x00, 0xE0, 0xB4, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0xB0, 0x00, 0xFF, 0x90, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 80 <P>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xE0, 0x00, 0x78, 0x68, 0x00, 0xB0, 0x1D, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x1D, 0x00, 0xB0, 0x2C, 0x00, 0x2E, 0xB4, 0x00, 0x0B, 0x80, 0x00, 0x02, 0xC1, 0x00, 0x01, 0xBE, 0x00, 0x00, 0x00, 0x00,  // Символ 81 <Q>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x00, 0xE1, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0xE1, 0xD0, 0x00, 0xFE, 0x40, 0x00, 0xE3, 0x40, 0x00, 0xE2, 0x80, 0x00, 0xE0, 0xD0, 0x00, 0xE0, 0xA0, 0x00, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 82 <R>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xE0, 0x00, 0xA4, 0x10, 0x00, 0xE0, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x2F, 0x80, 0x00, 0x02, 0xF0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x38, 0x00, 0xAA, 0xE0, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 83 <S>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 84 <T>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x74, 0x00, 0x7A, 0xE0, 0x00, 0x1A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 85 <U>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0A, 0x00, 0xA0, 0x0D, 0x00, 0xB0, 0x2C, 0x00, 0x34, 0x28, 0x00, 0x28, 0x34, 0x00, 0x2C, 0xB0, 0x00, 0x0D, 0xA0, 0x00, 0x0A, 0xD0, 0x00, 0x0A, 0xC0, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 86 <V>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x2C, 0x00, 0xE0, 0x2C, 0x00, 0xE0, 0x2C, 0x00, 0xE3, 0x2C, 0x00, 0xEB, 0xAC, 0x00, 0xAA, 0xA8, 0x00, 0xAC, 0xE8, 0x00, 0xA8, 0xB8, 0x00, 0xB4, 0x78, 0x00, 0x60, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 87 <W>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x74, 0x1D, 0x00, 0x28, 0x28, 0x00, 0x0E, 0xB0, 0x00, 0x07, 0xD0, 0x00, 0x03, 0xC0, 0x00, 0x0B, 0xD0, 0x00, 0x0E, 0xB0, 0x00, 0x28, 0x28, 0x00, 0x74, 0x1D, 0x00, 0x90, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 88 <X>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x07, 0x40, 0x78, 0x0A, 0x00, 0x2C, 0x2C, 0x00, 0x0E, 0x38, 0x00, 0x07, 0xA0, 0x00, 0x02, 0xD0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 89 <Y>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00, 0x70, 0x00, 0x00, 0xD0, 0x00, 0x02, 0x80, 0x00, 0x07, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x28, 0x00, 0x00, 0x34, 0x00, 0x00, 0xAA, 0xA0, 0x00, 0xAA, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 90 <Z>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xEA, 0x00, 0x00, 0xAA, 0x00, 0x00,  // Символ 91 <[>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x30, 0x00, 0x00, 0x28, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x09, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x03, 0x40, 0x00, 0x02, 0x80, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 92 <\>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0xAB, 0x00, 0x00, 0xAA, 0x00, 0x00,  // Символ 93 <]>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x2B, 0x40, 0x00, 0x71, 0xC0, 0x00, 0xA0, 0xA0, 0x00, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 94 <^>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0x00, 0xAA, 0xAA, 0x00,  // Символ 95 <_>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB4, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 96 <`>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0xAA, 0xE0, 0x00, 0x00, 0xB0, 0x00, 0x1A, 0xB0, 0x00, 0xBA, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xBA, 0xF0, 0x00, 0x29, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 97 <a>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE6, 0x80, 0x00, 0xEA, 0xA0, 0x00, 0xE0, 0x78, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x74, 0x00, 0xEA, 0xE0, 0x00, 0x2A, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 98 <b>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x7A, 0xA0, 0x00, 0xB0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x7A, 0xA0, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 99 <c>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x0A, 0xB8, 0x00, 0x7A, 0xB8, 0x00, 0xA0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0xB8, 0x00, 0x7A, 0xB8, 0x00, 0x1A, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 100 <d>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x40, 0x00, 0x7A, 0xE0, 0x00, 0xA0, 0x74, 0x00, 0xEA, 0xB8, 0x00, 0xEA, 0xA4, 0x00, 0xA0, 0x00, 0x00, 0x7A, 0xA0, 0x00, 0x0A, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 101 <e>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x03, 0xA8, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0xAB, 0xA4, 0x00, 0xAB, 0xA4, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 102 <f>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xA8, 0x00, 0x3A, 0xB8, 0x00, 0xB0, 0x38, 0x00, 0x74, 0x74, 0x00, 0x3F, 0xE0, 0x00, 0xB0, 0x00, 0x00, 0x7A, 0xA0, 0x00, 0xBA, 0xB8, 0x00, 0xE0, 0x2C, 0x00, 0xBA, 0xB4, 0x00, 0x1A, 0x80, 0x00,  // Символ 103 <g>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE6, 0x80, 0x00, 0xEA, 0xE0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 104 <h>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x05, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0xAB, 0x90, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 105 <i>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00, 0x03, 0xC0, 0x00, 0x01, 0x40, 0x00, 0x6A, 0x80, 0x00, 0x6A, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0x02, 0xC0, 0x00, 0xAB, 0x40, 0x00, 0x69, 0x00, 0x00,  // Символ 106 <j>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x60, 0x00, 0xE1, 0xD0, 0x00, 0xE7, 0x40, 0x00, 0xED, 0x00, 0x00, 0xEA, 0x00, 0x00, 0xE7, 0x40, 0x00, 0xE1, 0xD0, 0x00, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 107 <k>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x00, 0x00, 0xAB, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0x0B, 0x00, 0x00, 0xAB, 0x90, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 108 <l>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0x28, 0x00, 0xFB, 0xAE, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0xE3, 0x8E, 0x00, 0x92, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 109 <m>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x80, 0x00, 0xEA, 0xE0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0x90, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 110 <n>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x80, 0x00, 0x7A, 0xB4, 0x00, 0xA0, 0x28, 0x00, 0xE0, 0x2C, 0x00, 0xE0, 0x2C, 0x00, 0xA0, 0x28, 0x00, 0x7A, 0xB4, 0x00, 0x0A, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 111 <o>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x80, 0x00, 0xEA, 0xA0, 0x00, 0xE0, 0x78, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x38, 0x00, 0xE0, 0x74, 0x00, 0xEA, 0xE0, 0x00, 0xEA, 0x40, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x90, 0x00, 0x00,  // Символ 112 <p>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xA9, 0x00, 0x1E, 0xAE, 0x00, 0x28, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x0E, 0x00, 0x38, 0x2E, 0x00, 0x1E, 0xAE, 0x00, 0x06, 0x8E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x09, 0x00,  // Символ 113 <q>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x80, 0x00, 0xEA, 0xE0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 114 <r>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0x40, 0x00, 0xBA, 0x80, 0x00, 0xE0, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x1B, 0xD0, 0x00, 0x00, 0xE0, 0x00, 0xAA, 0xD0, 0x00, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 115 <s>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xAE, 0xA4, 0x00, 0xAE, 0xA4, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0B, 0xA4, 0x00, 0x02, 0xA4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 116 <t>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x60, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xE0, 0xB0, 0x00, 0xBA, 0xB0, 0x00, 0x29, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 117 <u>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x14, 0x00, 0xE0, 0x34, 0x00, 0xB0, 0x70, 0x00, 0x34, 0xA0, 0x00, 0x28, 0xC0, 0x00, 0x1E, 0x80, 0x00, 0x0E, 0x40, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 118 <v>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0xC0, 0x0C, 0x00, 0xD7, 0x1C, 0x00, 0xAA, 0x68, 0x00, 0xAA, 0xA8, 0x00, 0xA8, 0xE8, 0x00, 0xA8, 0xB4, 0x00, 0x24, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 119 <w>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x18, 0x00, 0x74, 0x74, 0x00, 0x2C, 0xE0, 0x00, 0x0B, 0x80, 0x00, 0x0B, 0x80, 0x00, 0x1C, 0xE0, 0x00, 0x74, 0x74, 0x00, 0xA0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 120 <x>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x08, 0x00, 0xB0, 0x28, 0x00, 0x38, 0x38, 0x00, 0x28, 0x70, 0x00, 0x1C, 0xA0, 0x00, 0x0A, 0xD0, 0x00, 0x0B, 0x80, 0x00, 0x03, 0x40, 0x00, 0x0A, 0x00, 0x00, 0xAD, 0x00, 0x00, 0xA0, 0x00, 0x00,  // Символ 121 <y>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0x90, 0x00, 0xAA, 0xD0, 0x00, 0x02, 0x80, 0x00, 0x0A, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x34, 0x00, 0x00, 0xAA, 0x90, 0x00, 0xAA, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 122 <z>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x0A, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1D, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0B, 0x80, 0x00, 0x02, 0x80, 0x00,  // Символ 123 <{>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x90, 0x00, 0x00,  // Символ 124 <|>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x00, 0x00, 0x28, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x1D, 0x00, 0x00, 0x0B, 0xC0, 0x00, 0x1D, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0x2C, 0x00, 0x00, 0xB8, 0x00, 0x00, 0xA0, 0x00, 0x00,  // Символ 125 <}>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x09, 0x00, 0xE2, 0x5E, 0x00, 0x90, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // Символ 126 <~>
+};
+
+// описание шрифта для print_char_font()
+const st7735_font fd_consolas_11_g2 = { font_consolas_11_g2, 0, 51, 9, 17, 32, 95, BITS_G2, 0 };
+
+#endif // FONT_CONSOLAS_11_G2_H
@@ -0,0 +1,260 @@
+// Consolas 18 (из consolas_18_font.h), матрицы обрезаны по рамке изображения (ST7735_FONT_BOX):
+// у каждого символа 4 байта рамки {x, y, ширина, высота}, затем только точки внутри рамки
+// 6684 байт матриц + 448 байт смещений вместо 11648, сгенерировано tools/fontc
+
+#ifndef FONT_CONSOLAS_18_BOX_H
+#define FONT_CONSOLAS_18_BOX_H
+
+#include "lcd7735sl.h"
+
+const unsigned char font_consolas_18_box[6684] =
+{
+    0x00, 0x00, 0x00, 0x00,  // Символ 32 < >
+    0x06, 0x03, 0x03, 0x11, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x07, 0x07, 0x07,  // Символ 33 <!>
+    0x03, 0x03, 0x08, 0x06, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7, 0xE7,  // Символ 34 <">
+    0x01, 0x05, 0x0C, 0x0F, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0xFE, 0x0F, 0xFE, 0x0F, 0x98, 0x01, 0x98, 0x01, 0x98, 0x01, 0xFF, 0x07, 0xFF, 0x07, 0xCC, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0xCC, 0x00,  // Символ 35 <#>
+    0x02, 0x02, 0x0A, 0x15, 0x60, 0x00, 0x60, 0x00, 0xF8, 0x01, 0xFE, 0x01, 0x27, 0x00, 0x23, 0x00, 0x23, 0x00, 0x37, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF0, 0x00, 0xF0, 0x01, 0x30, 0x03, 0x10, 0x03, 0x10, 0x03, 0x99, 0x03, 0xFF, 0x01, 0x7E, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,  // Символ 36 <$>
+    0x01, 0x03, 0x0D, 0x11, 0x3C, 0x18, 0x7E, 0x0C, 0x63, 0x06, 0x63, 0x06, 0x63, 0x03, 0xBF, 0x01, 0x9E, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x0F, 0x90, 0x1F, 0xD8, 0x18, 0xCC, 0x18, 0xCC, 0x18, 0xC6, 0x0F, 0x83, 0x07,  // Символ 37 <%>
+    0x01, 0x03, 0x0C, 0x11, 0x78, 0x00, 0xFC, 0x00, 0xCE, 0x01, 0x86, 0x01, 0x86, 0x01, 0xC6, 0x01, 0xEC, 0x00, 0x7C, 0x00, 0x1C, 0x00, 0x3E, 0x06, 0x77, 0x06, 0xE3, 0x06, 0xC3, 0x03, 0x83, 0x03, 0xC7, 0x03, 0xFE, 0x07, 0x7C, 0x0E,  // Символ 38 <&>
+    0x06, 0x03, 0x03, 0x06, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,  // Символ 39 <'>
+    0x04, 0x03, 0x07, 0x16, 0x20, 0x70, 0x38, 0x18, 0x0C, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x0C, 0x1C, 0x38, 0x70, 0x20,  // Символ 40 <(>
+    0x04, 0x03, 0x07, 0x16, 0x02, 0x07, 0x0E, 0x1C, 0x18, 0x30, 0x30, 0x70, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x18, 0x0C, 0x0E, 0x07, 0x02,  // Символ 41 <)>
+    0x02, 0x03, 0x0A, 0x0A, 0x30, 0x00, 0x30, 0x00, 0x32, 0x01, 0xB7, 0x03, 0x78, 0x00, 0x78, 0x00, 0xB7, 0x03, 0x33, 0x01, 0x30, 0x00, 0x30, 0x00,  // Символ 42 <*>
+    0x01, 0x07, 0x0C, 0x0C, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xFF, 0x0F, 0xFF, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,  // Символ 43 <+>
+    0x04, 0x10, 0x06, 0x08, 0x1C, 0x3C, 0x3C, 0x38, 0x38, 0x1C, 0x0F, 0x07,  // Символ 44 <,>
+    0x04, 0x0D, 0x07, 0x02, 0x7F, 0x7F,  // Символ 45 <->
+    0x05, 0x10, 0x04, 0x04, 0x06, 0x0F, 0x0F, 0x06,  // Символ 46 <.>
+    0x02, 0x03, 0x0A, 0x14, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00,  // Символ 47 </>
+    0x02, 0x05, 0x0B, 0x0F, 0xF8, 0x00, 0xFC, 0x01, 0x8E, 0x03, 0x06, 0x03, 0x03, 0x07, 0x83, 0x07, 0xE3, 0x06, 0x73, 0x06, 0x3B, 0x06, 0x0F, 0x06, 0x07, 0x06, 0x06, 0x03, 0x8E, 0x03, 0xFC, 0x01, 0xF8, 0x00,  // Символ 48 <0>
+    0x02, 0x05, 0x0A, 0x0F, 0x38, 0x00, 0x3E, 0x00, 0x37, 0x00, 0x32, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x03, 0xFF, 0x03,  // Символ 49 <1>
+    0x02, 0x05, 0x0A, 0x0F, 0x7C, 0x00, 0xFE, 0x00, 0xC7, 0x01, 0x82, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0xFF, 0x03, 0xFF, 0x03,  // Символ 50 <2>
+    0x03, 0x05, 0x09, 0x0F, 0x3E, 0x00, 0x7F, 0x00, 0xE1, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x3C, 0x00, 0xFC, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0xFF, 0x00, 0x3F, 0x00,  // Символ 51 <3>
+    0x01, 0x05, 0x0C, 0x0F, 0xC0, 0x01, 0xE0, 0x01, 0xE0, 0x01, 0xB0, 0x01, 0x98, 0x01, 0x98, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x86, 0x01, 0x83, 0x01, 0xFF, 0x0F, 0xFF, 0x0F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,  // Символ 52 <4>
+    0x03, 0x05, 0x09, 0x0F, 0xFF, 0x00, 0xFF, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x7F, 0x00, 0xFF, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x00,  // Символ 53 <5>
+    0x02, 0x05, 0x0A, 0x0F, 0xF0, 0x01, 0xF8, 0x01, 0x1C, 0x00, 0x06, 0x00, 0x02, 0x00, 0x03, 0x00, 0xFB, 0x00, 0xFF, 0x01, 0x87, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x86, 0x01, 0xFE, 0x01, 0x78, 0x00,  // Символ 54 <6>
+    0x02, 0x05, 0x0A, 0x0F, 0xFF, 0x03, 0xFF, 0x03, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0C, 0x00,  // Символ 55 <7>
+    0x02, 0x05, 0x0A, 0x0F, 0xFC, 0x00, 0xFE, 0x01, 0x87, 0x03, 0x03, 0x03, 0x03, 0x03, 0xCE, 0x01, 0xFC, 0x00, 0xFC, 0x00, 0xCE, 0x01, 0x87, 0x03, 0x03, 0x03, 0x03, 0x03, 0x87, 0x03, 0xFE, 0x01, 0xFC, 0x00,  // Символ 56 <8>
+    0x02, 0x05, 0x0A, 0x0F, 0x78, 0x00, 0xFE, 0x01, 0x86, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x87, 0x03, 0xFE, 0x03, 0x7C, 0x03, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0xE0, 0x00, 0x7E, 0x00, 0x3E, 0x00,  // Символ 57 <9>
+    0x06, 0x08, 0x03, 0x0C, 0x02, 0x07, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x07, 0x07, 0x02,  // Символ 58 <:>
+    0x04, 0x08, 0x06, 0x10, 0x08, 0x1C, 0x1C, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x3C, 0x3C, 0x38, 0x38, 0x1C, 0x0F, 0x07,  // Символ 59 <;>
+    0x03, 0x07, 0x09, 0x0D, 0x80, 0x00, 0xC0, 0x01, 0xE0, 0x00, 0x30, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x30, 0x00, 0xE0, 0x00, 0xC0, 0x01, 0x80, 0x00,  // Символ 60 <<>
+    0x02, 0x0A, 0x0A, 0x06, 0xFF, 0x03, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0x03,  // Символ 61 <=>
+    0x03, 0x07, 0x09, 0x0D, 0x02, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x18, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xC0, 0x01, 0xE0, 0x00, 0x70, 0x00, 0x18, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x02, 0x00,  // Символ 62 <>>
+    0x04, 0x03, 0x07, 0x11, 0x07, 0x1F, 0x38, 0x70, 0x60, 0x60, 0x60, 0x70, 0x3C, 0x3C, 0x0C, 0x0C, 0x00, 0x00, 0x0E, 0x0E, 0x0E,  // Символ 63 <?>
+    0x01, 0x03, 0x0D, 0x16, 0xE0, 0x03, 0x30, 0x06, 0x18, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x06, 0x18, 0xC6, 0x1B, 0xE6, 0x1B, 0x63, 0x1B, 0x33, 0x1B, 0x33, 0x19, 0xB3, 0x19, 0xB3, 0x19, 0xB3, 0x19, 0xB3, 0x0D, 0xF3, 0x0F, 0x63, 0x07, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x1C, 0x02, 0xF0, 0x01,  // Символ 64 <@>
+    0x01, 0x05, 0x0C, 0x0F, 0x70, 0x00, 0xD0, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0x98, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x0C, 0x03, 0x04, 0x03, 0x06, 0x03, 0xFE, 0x07, 0xFE, 0x07, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x0C,  // Символ 65 <A>
+    0x02, 0x05, 0x0A, 0x0F, 0x7F, 0x00, 0xFF, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x00, 0x7F, 0x00, 0xFF, 0x01, 0x83, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x01, 0xFF, 0x01, 0x7F, 0x00,  // Символ 66 <B>
+    0x02, 0x05, 0x0A, 0x0F, 0xF0, 0x01, 0xFC, 0x03, 0x0E, 0x02, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x02, 0xFC, 0x03, 0xF0, 0x01,  // Символ 67 <C>
+    0x02, 0x05, 0x0B, 0x0F, 0x7F, 0x00, 0xFF, 0x01, 0x83, 0x03, 0x03, 0x03, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x07, 0x03, 0x03, 0xC3, 0x03, 0xFF, 0x01, 0x7F, 0x00,  // Символ 68 <D>
+    0x03, 0x05, 0x09, 0x0F, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01,  // Символ 69 <E>
+    0x03, 0x05, 0x09, 0x0F, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 70 <F>
+    0x02, 0x05, 0x0B, 0x0F, 0xF0, 0x03, 0xF8, 0x07, 0x1C, 0x04, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0xC3, 0x07, 0xC3, 0x07, 0x03, 0x06, 0x03, 0x06, 0x07, 0x06, 0x06, 0x06, 0x0E, 0x06, 0xFC, 0x07, 0xF0, 0x03,  // Символ 71 <G>
+    0x02, 0x05, 0x0B, 0x0F, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06,  // Символ 72 <H>
+    0x02, 0x05, 0x0A, 0x0F, 0xFF, 0x03, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x03, 0xFF, 0x03,  // Символ 73 <I>
+    0x03, 0x05, 0x08, 0x0F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE1, 0x7F, 0x3E,  // Символ 74 <J>
+    0x02, 0x05, 0x0A, 0x0F, 0x03, 0x03, 0x83, 0x01, 0xC3, 0x00, 0x63, 0x00, 0x73, 0x00, 0x33, 0x00, 0x1B, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x73, 0x00, 0xE3, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x03, 0x03,  // Символ 75 <K>
+    0x03, 0x05, 0x09, 0x0F, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01,  // Символ 76 <L>
+    0x01, 0x05, 0x0C, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x8F, 0x07, 0x8B, 0x06, 0xDB, 0x06, 0xDB, 0x06, 0x53, 0x06, 0x73, 0x06, 0x23, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x0E, 0x03, 0x0E,  // Символ 77 <M>
+    0x02, 0x05, 0x0B, 0x0F, 0x07, 0x06, 0x0F, 0x06, 0x0F, 0x06, 0x1B, 0x06, 0x1B, 0x06, 0x13, 0x06, 0x33, 0x06, 0x23, 0x06, 0x63, 0x06, 0x63, 0x06, 0xC3, 0x06, 0xC3, 0x06, 0x83, 0x07, 0x83, 0x07, 0x03, 0x07,  // Символ 78 <N>
+    0x01, 0x05, 0x0C, 0x0F, 0xF0, 0x01, 0xFC, 0x03, 0x0E, 0x07, 0x06, 0x06, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x06, 0x06, 0x0E, 0x07, 0xFC, 0x03, 0xF8, 0x00,  // Символ 79 <O>
+    0x02, 0x05, 0x0A, 0x0F, 0x7F, 0x00, 0xFF, 0x01, 0x83, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x01, 0xFF, 0x00, 0x7F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 80 <P>
+    0x01, 0x05, 0x0D, 0x13, 0xF0, 0x01, 0xFC, 0x03, 0x0E, 0x07, 0x06, 0x06, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x06, 0x06, 0x0E, 0x07, 0xFC, 0x03, 0xF8, 0x00, 0x60, 0x00, 0xE0, 0x18, 0xC0, 0x1F, 0x80, 0x07,  // Символ 81 <Q>
+    0x02, 0x05, 0x0A, 0x0F, 0x7F, 0x00, 0xFF, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x00, 0xFF, 0x00, 0x3F, 0x00, 0x63, 0x00, 0xE3, 0x00, 0xC3, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x03,  // Символ 82 <R>
+    0x02, 0x05, 0x0A, 0x0F, 0xF8, 0x00, 0xFE, 0x01, 0x07, 0x01, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1E, 0x00, 0xF8, 0x00, 0xE0, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x81, 0x03, 0xFF, 0x01, 0x7E, 0x00,  // Символ 83 <S>
+    0x01, 0x05, 0x0C, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,  // Символ 84 <T>
+    0x02, 0x05, 0x0B, 0x0F, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x07, 0x03, 0xFE, 0x03, 0xF8, 0x00,  // Символ 85 <U>
+    0x01, 0x05, 0x0D, 0x0F, 0x03, 0x18, 0x03, 0x18, 0x07, 0x1C, 0x06, 0x0C, 0x06, 0x0C, 0x0C, 0x06, 0x0C, 0x06, 0x1C, 0x06, 0x18, 0x03, 0x18, 0x03, 0xB8, 0x03, 0xB0, 0x01, 0xB0, 0x01, 0xF0, 0x00, 0xE0, 0x00,  // Символ 86 <V>
+    0x02, 0x05, 0x0B, 0x0F, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x23, 0x06, 0x63, 0x06, 0x53, 0x06, 0x53, 0x06, 0x53, 0x06, 0xD6, 0x02, 0xDE, 0x03, 0xDE, 0x03, 0x8E, 0x03, 0x8E, 0x03,  // Символ 87 <W>
+    0x01, 0x05, 0x0D, 0x0F, 0x0E, 0x1C, 0x0C, 0x0C, 0x18, 0x06, 0x38, 0x07, 0xB0, 0x03, 0xF0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xB0, 0x03, 0x38, 0x03, 0x1C, 0x07, 0x0C, 0x06, 0x0E, 0x0E, 0x07, 0x1C,  // Символ 88 <X>
+    0x00, 0x05, 0x0E, 0x0F, 0x03, 0x30, 0x06, 0x18, 0x0E, 0x1C, 0x0C, 0x0C, 0x18, 0x06, 0x38, 0x06, 0x30, 0x03, 0xF0, 0x03, 0xE0, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,  // Символ 89 <Y>
+    0x02, 0x05, 0x0B, 0x0F, 0xFF, 0x03, 0xFF, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0xFF, 0x07, 0xFF, 0x07,  // Символ 90 <Z>
+    0x04, 0x03, 0x06, 0x16, 0x3F, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x3F,  // Символ 91 <[>
+    0x02, 0x03, 0x0A, 0x14, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x30, 0x00, 0x30, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x03,  // Символ 92 <\>
+    0x04, 0x03, 0x06, 0x16, 0x3F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x3F, 0x3F,  // Символ 93 <]>
+    0x03, 0x05, 0x09, 0x07, 0x38, 0x00, 0x38, 0x00, 0x6C, 0x00, 0x44, 0x00, 0xC6, 0x00, 0x83, 0x01, 0x83, 0x01,  // Символ 94 <^>
+    0x01, 0x17, 0x0D, 0x02, 0xFF, 0x1F, 0xFF, 0x1F,  // Символ 95 <_>
+    0x05, 0x03, 0x05, 0x03, 0x07, 0x0E, 0x1C,  // Символ 96 <`>
+    0x02, 0x08, 0x0A, 0x0C, 0xFC, 0x00, 0xFE, 0x01, 0x82, 0x03, 0x00, 0x03, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x03, 0x07, 0x03, 0x03, 0x03, 0xC3, 0x03, 0xFF, 0x03, 0x7C, 0x03,  // Символ 97 <a>
+    0x02, 0x03, 0x0A, 0x11, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xF3, 0x00, 0xFF, 0x01, 0x8F, 0x01, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x03, 0xC3, 0x01, 0xFF, 0x00, 0x7E, 0x00,  // Символ 98 <b>
+    0x03, 0x08, 0x09, 0x0C, 0xF8, 0x00, 0xFC, 0x01, 0x0E, 0x01, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x01, 0xFE, 0x01, 0xF8, 0x00,  // Символ 99 <c>
+    0x02, 0x03, 0x0A, 0x11, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0xF8, 0x03, 0xFC, 0x03, 0x0E, 0x03, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x03, 0xC6, 0x03, 0x7E, 0x03, 0x3C, 0x03,  // Символ 100 <d>
+    0x02, 0x08, 0x0A, 0x0C, 0x78, 0x00, 0xFC, 0x01, 0x86, 0x01, 0x03, 0x03, 0x03, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0x03, 0x00, 0x03, 0x00, 0x06, 0x01, 0xFE, 0x01, 0xF8, 0x00,  // Символ 101 <e>
+    0x02, 0x03, 0x0B, 0x11, 0xC0, 0x07, 0xE0, 0x07, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,  // Символ 102 <f>
+    0x02, 0x08, 0x0B, 0x11, 0xF8, 0x07, 0xFC, 0x07, 0x8E, 0x03, 0x06, 0x03, 0x06, 0x03, 0x8E, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFE, 0x01, 0xFE, 0x07, 0x03, 0x06, 0x03, 0x06, 0x07, 0x07, 0xFE, 0x03, 0xFC, 0x00,  // Символ 103 <g>
+    0x03, 0x03, 0x09, 0x11, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x73, 0x00, 0xFF, 0x00, 0xCF, 0x01, 0x87, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,  // Символ 104 <h>
+    0x03, 0x03, 0x09, 0x11, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x01, 0xFF, 0x01,  // Символ 105 <i>
+    0x03, 0x03, 0x08, 0x16, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x61, 0x7F, 0x3E,  // Символ 106 <j>
+    0x02, 0x03, 0x0A, 0x11, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x83, 0x03, 0xC3, 0x01, 0xE3, 0x00, 0x73, 0x00, 0x1B, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x63, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x03, 0x03,  // Символ 107 <k>
+    0x03, 0x03, 0x09, 0x11, 0x3F, 0x00, 0x3F, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x01, 0xFF, 0x01,  // Символ 108 <l>
+    0x01, 0x08, 0x0C, 0x0C, 0x3B, 0x07, 0xFF, 0x0F, 0xE7, 0x0C, 0xE7, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C,  // Символ 109 <m>
+    0x03, 0x08, 0x09, 0x0C, 0x73, 0x00, 0xFF, 0x00, 0xCF, 0x01, 0x87, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,  // Символ 110 <n>
+    0x02, 0x08, 0x0B, 0x0C, 0xF8, 0x00, 0xFC, 0x03, 0x8E, 0x03, 0x07, 0x07, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x07, 0x07, 0x8E, 0x03, 0xFE, 0x01, 0xF8, 0x00,  // Символ 111 <o>
+    0x02, 0x08, 0x0A, 0x11, 0xF3, 0x00, 0xFF, 0x01, 0x8F, 0x01, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x03, 0xC3, 0x01, 0xFF, 0x00, 0x7F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 112 <p>
+    0x02, 0x08, 0x0A, 0x11, 0xF8, 0x03, 0xFC, 0x03, 0x0E, 0x03, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x03, 0xC6, 0x03, 0xFE, 0x03, 0x3C, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,  // Символ 113 <q>
+    0x02, 0x08, 0x0A, 0x0C, 0xF3, 0x00, 0xFB, 0x01, 0x8F, 0x03, 0x07, 0x03, 0x03, 0x03, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 114 <r>
+    0x03, 0x08, 0x09, 0x0C, 0x7C, 0x00, 0xFE, 0x00, 0x83, 0x00, 0x03, 0x00, 0x07, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x81, 0x01, 0xFF, 0x00, 0x7E, 0x00,  // Символ 115 <s>
+    0x02, 0x04, 0x0B, 0x10, 0x10, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xFF, 0x07, 0xFF, 0x07, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x38, 0x00, 0x30, 0x00, 0xF0, 0x07, 0xE0, 0x07,  // Символ 116 <t>
+    0x03, 0x08, 0x09, 0x0C, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x01, 0xE7, 0x01, 0xFE, 0x01, 0x9C, 0x01,  // Символ 117 <u>
+    0x02, 0x08, 0x0B, 0x0C, 0x03, 0x06, 0x03, 0x06, 0x07, 0x03, 0x06, 0x03, 0x06, 0x03, 0x8C, 0x01, 0x8C, 0x01, 0x8C, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0x50, 0x00, 0x70, 0x00,  // Символ 118 <v>
+    0x02, 0x08, 0x0B, 0x0C, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x23, 0x06, 0x73, 0x06, 0x53, 0x06, 0x53, 0x06, 0xDB, 0x02, 0xDA, 0x02, 0x8A, 0x02, 0x8E, 0x03, 0x8E, 0x03,  // Символ 119 <w>
+    0x02, 0x08, 0x0B, 0x0C, 0x07, 0x07, 0x0E, 0x03, 0x8C, 0x01, 0xDC, 0x01, 0xF8, 0x00, 0x70, 0x00, 0x70, 0x00, 0xD8, 0x00, 0xDC, 0x01, 0x8C, 0x01, 0x8E, 0x03, 0x07, 0x07,  // Символ 120 <x>
+    0x01, 0x08, 0x0C, 0x11, 0x06, 0x0C, 0x06, 0x0C, 0x0E, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x18, 0x03, 0x18, 0x03, 0xB8, 0x01, 0xB0, 0x01, 0xB0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1F, 0x00, 0x0F, 0x00,  // Символ 121 <y>
+    0x03, 0x08, 0x09, 0x0C, 0xFF, 0x01, 0xFF, 0x01, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0xFF, 0x01, 0xFF, 0x01,  // Символ 122 <z>
+    0x03, 0x03, 0x08, 0x16, 0xE0, 0xF0, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x0F, 0x0F, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF0, 0xE0,  // Символ 123 <{>
+    0x06, 0x01, 0x02, 0x18, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 124 <|>
+    0x03, 0x03, 0x08, 0x16, 0x07, 0x0F, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x38, 0xF0, 0xF0, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1C, 0x0F, 0x07,  // Символ 125 <}>
+    0x01, 0x0B, 0x0C, 0x05, 0x1C, 0x00, 0x3E, 0x0C, 0x63, 0x0C, 0xC3, 0x07, 0x80, 0x03,  // Символ 126 <~>
+    0x05, 0x05, 0x05, 0x0E, 0x1F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x1F,  // Символ 127 <>
+    0x01, 0x05, 0x0C, 0x0F, 0xFF, 0x00, 0xFF, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xF8, 0x03, 0xF8, 0x07, 0x18, 0x0E, 0x18, 0x0C, 0x18, 0x0C, 0x18, 0x0C, 0x18, 0x0C, 0x18, 0x06, 0x98, 0x07, 0x98, 0x01,  // Символ 128 <Ђ>
+    0x03, 0x00, 0x09, 0x14, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 129 <Ѓ>
+    0x04, 0x10, 0x06, 0x08, 0x1C, 0x3C, 0x3C, 0x38, 0x38, 0x1C, 0x0F, 0x07,  // Символ 130 <‚>
+    0x03, 0x03, 0x08, 0x11, 0x70, 0x38, 0x1C, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 131 <ѓ>
+    0x02, 0x11, 0x0B, 0x07, 0x0C, 0x03, 0x1C, 0x07, 0x18, 0x06, 0x18, 0x06, 0x1C, 0x07, 0xCF, 0x03, 0xC3, 0x00,  // Символ 132 <„>
+    0x01, 0x11, 0x0D, 0x03, 0xE7, 0x1C, 0xE7, 0x1C, 0xE7, 0x1C,  // Символ 133 <…>
+    0x03, 0x03, 0x08, 0x0E, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,  // Символ 134 <†>
+    0x03, 0x03, 0x08, 0x11, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF, 0x18, 0x18, 0x18,  // Символ 135 <‡>
+    0x01, 0x05, 0x0C, 0x0F, 0xC0, 0x07, 0xF0, 0x0F, 0x38, 0x08, 0x18, 0x00, 0x0C, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0x0C, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0x0C, 0x00, 0x18, 0x00, 0x38, 0x08, 0xF0, 0x0F, 0xE0, 0x07,  // Символ 136 <€>
+    0x01, 0x03, 0x0D, 0x11, 0x1E, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x33, 0x10, 0x1E, 0x0C, 0x00, 0x03, 0xC0, 0x00, 0x38, 0x00, 0x06, 0x00, 0x01, 0x00, 0x3C, 0x0F, 0xE6, 0x19, 0xE6, 0x19, 0xE6, 0x19, 0xE6, 0x19, 0x3C, 0x0F,  // Символ 137 <‰>
+    0x01, 0x05, 0x0D, 0x0F, 0xF8, 0x00, 0xF8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xD8, 0x07, 0xDC, 0x0F, 0xCC, 0x1C, 0xCC, 0x18, 0xCC, 0x18, 0xCC, 0x18, 0xCE, 0x1C, 0xC7, 0x0F, 0xC3, 0x07,  // Символ 138 <Љ>
+    0x05, 0x09, 0x05, 0x0A, 0x08, 0x1C, 0x0E, 0x06, 0x03, 0x03, 0x06, 0x0E, 0x1C, 0x08,  // Символ 139 <‹>
+    0x01, 0x05, 0x0C, 0x0F, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0xFF, 0x03, 0xFF, 0x07, 0x63, 0x0E, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0E, 0xE3, 0x07, 0xE3, 0x03,  // Символ 140 <Њ>
+    0x02, 0x00, 0x0A, 0x14, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x83, 0x01, 0xC3, 0x00, 0x63, 0x00, 0x73, 0x00, 0x33, 0x00, 0x1B, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x73, 0x00, 0xE3, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x03, 0x03,  // Символ 141 <Ќ>
+    0x01, 0x05, 0x0D, 0x0F, 0xFF, 0x01, 0xFF, 0x01, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xF8, 0x07, 0xF8, 0x0F, 0x18, 0x1C, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,  // Символ 142 <Ћ>
+    0x02, 0x05, 0x0A, 0x12, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,  // Символ 143 <Џ>
+    0x01, 0x03, 0x0C, 0x16, 0x0C, 0x00, 0x0C, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0x0C, 0x00, 0xCC, 0x03, 0xFC, 0x07, 0x3C, 0x06, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x80, 0x07, 0x80, 0x03,  // Символ 144 <ђ>
+    0x04, 0x03, 0x06, 0x08, 0x38, 0x3C, 0x0E, 0x07, 0x07, 0x0F, 0x0F, 0x0E,  // Символ 145 <‘>
+    0x04, 0x03, 0x06, 0x08, 0x1C, 0x3C, 0x3C, 0x38, 0x38, 0x1C, 0x0F, 0x07,  // Символ 146 <’>
+    0x02, 0x03, 0x0B, 0x07, 0x18, 0x06, 0x9E, 0x07, 0xC7, 0x01, 0xC3, 0x00, 0xC3, 0x00, 0xC7, 0x01, 0x86, 0x01,  // Символ 147 <“>
+    0x02, 0x03, 0x0B, 0x07, 0x0C, 0x03, 0x1C, 0x07, 0x18, 0x06, 0x18, 0x06, 0x1C, 0x07, 0xCF, 0x03, 0xC3, 0x00,  // Символ 148 <”>
+    0x04, 0x0A, 0x07, 0x07, 0x1C, 0x3E, 0x7F, 0x7F, 0x7F, 0x3E, 0x1C,  // Символ 149 <•>
+    0x02, 0x0C, 0x0A, 0x02, 0xFF, 0x03, 0xFF, 0x03,  // Символ 150 <–>
+    0x01, 0x0C, 0x0D, 0x02, 0xFF, 0x1F, 0xFF, 0x1F,  // Символ 151 <—>
+    0x00, 0x00, 0x00, 0x00,  // Символ 152 <>
+    0x01, 0x05, 0x0D, 0x06, 0xBF, 0x19, 0x8C, 0x1D, 0xCC, 0x1D, 0x4C, 0x1D, 0x4C, 0x1B, 0x4C, 0x1A,  // Символ 153 <™>
+    0x01, 0x08, 0x0D, 0x0C, 0xFC, 0x00, 0xFC, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0xCC, 0x07, 0xCC, 0x0F, 0xCC, 0x18, 0xCC, 0x18, 0xC6, 0x18, 0xC6, 0x18, 0xC7, 0x0F, 0xC3, 0x07,  // Символ 154 <љ>
+    0x05, 0x09, 0x05, 0x0A, 0x02, 0x07, 0x0E, 0x0C, 0x18, 0x18, 0x0C, 0x0E, 0x07, 0x02,  // Символ 155 <›>
+    0x01, 0x08, 0x0C, 0x0C, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0xFF, 0x03, 0xFF, 0x07, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xE3, 0x07, 0xE3, 0x03,  // Символ 156 <њ>
+    0x02, 0x03, 0x0A, 0x11, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0xC3, 0x00, 0x63, 0x00, 0x33, 0x00, 0x1B, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x63, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x03, 0x03,  // Символ 157 <ќ>
+    0x02, 0x03, 0x0B, 0x11, 0x0C, 0x00, 0x0C, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x0C, 0x00, 0xCC, 0x01, 0xEC, 0x03, 0x3C, 0x07, 0x1C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0C, 0x06,  // Символ 158 <ћ>
+    0x02, 0x08, 0x0A, 0x0F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,  // Символ 159 <џ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 160 <>
+    0x02, 0x02, 0x0B, 0x12, 0x0C, 0x03, 0xF8, 0x01, 0x00, 0x00, 0x03, 0x06, 0x07, 0x06, 0x06, 0x07, 0x0C, 0x03, 0x1C, 0x03, 0x98, 0x01, 0xB8, 0x01, 0xB0, 0x01, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x3E, 0x00, 0x1E, 0x00,  // Символ 161 <Ў>
+    0x01, 0x03, 0x0C, 0x16, 0x18, 0x03, 0x18, 0x03, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0C, 0x06, 0x0C, 0x0E, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x18, 0x03, 0x18, 0x03, 0xB8, 0x01, 0xB0, 0x01, 0xB0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1F, 0x00, 0x0F, 0x00,  // Символ 162 <ў>
+    0x03, 0x05, 0x08, 0x0F, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xE1, 0x7F, 0x3E,  // Символ 163 <Ј>
+    0x02, 0x05, 0x0B, 0x0E, 0x02, 0x02, 0x07, 0x07, 0xFE, 0x03, 0xFC, 0x01, 0x8C, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x8E, 0x01, 0xFC, 0x01, 0xFE, 0x03, 0x07, 0x07, 0x02, 0x02,  // Символ 164 <¤>
+    0x03, 0x02, 0x09, 0x12, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 165 <Ґ>
+    0x06, 0x01, 0x02, 0x18, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 166 <¦>
+    0x02, 0x03, 0x0A, 0x14, 0xF8, 0x01, 0xFC, 0x01, 0x0E, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x7E, 0x00, 0xE7, 0x00, 0xC3, 0x01, 0x83, 0x03, 0x07, 0x03, 0x0E, 0x03, 0x9C, 0x03, 0xF0, 0x01, 0xE0, 0x00, 0x80, 0x01, 0x80, 0x01, 0xC1, 0x01, 0xFF, 0x00, 0x3E, 0x00,  // Символ 167 <§>
+    0x03, 0x00, 0x09, 0x14, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01,  // Символ 168 <Ё>
+    0x01, 0x05, 0x0D, 0x0F, 0xF0, 0x01, 0x1C, 0x07, 0x06, 0x0C, 0xC6, 0x0D, 0x63, 0x18, 0x33, 0x18, 0x33, 0x18, 0x33, 0x18, 0x33, 0x18, 0x33, 0x18, 0x63, 0x18, 0xE6, 0x0D, 0x06, 0x0C, 0x1C, 0x07, 0xF0, 0x01,  // Символ 169 <©>
+    0x02, 0x05, 0x0B, 0x0F, 0xF0, 0x03, 0xFC, 0x07, 0x0E, 0x04, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x04, 0xFC, 0x07, 0xF0, 0x03,  // Символ 170 <Є>
+    0x02, 0x09, 0x0A, 0x09, 0x08, 0x02, 0x0C, 0x03, 0x8E, 0x03, 0x86, 0x01, 0xC3, 0x00, 0x86, 0x01, 0x8E, 0x03, 0x0C, 0x03, 0x08, 0x02,  // Символ 171 <«>
+    0x02, 0x0C, 0x0A, 0x05, 0xFF, 0x03, 0xFF, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,  // Символ 172 <¬>
+    0x04, 0x0D, 0x07, 0x02, 0x7F, 0x7F,  // Символ 173 <>
+    0x03, 0x03, 0x09, 0x0B, 0x38, 0x00, 0xC6, 0x00, 0xBA, 0x00, 0x29, 0x01, 0x29, 0x01, 0x19, 0x01, 0x29, 0x01, 0x29, 0x01, 0xCA, 0x00, 0xC6, 0x00, 0x38, 0x00,  // Символ 174 <®>
+    0x02, 0x00, 0x0A, 0x14, 0xC6, 0x00, 0xC6, 0x00, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x03, 0xFF, 0x03,  // Символ 175 <Ї>
+    0x03, 0x03, 0x08, 0x08, 0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C,  // Символ 176 <°>
+    0x02, 0x06, 0x0A, 0x0E, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x03, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xFF, 0x03,  // Символ 177 <±>
+    0x02, 0x05, 0x0A, 0x0F, 0xFF, 0x03, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x03, 0xFF, 0x03,  // Символ 178 <І>
+    0x03, 0x03, 0x09, 0x11, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x01, 0xFF, 0x01,  // Символ 179 <і>
+    0x03, 0x05, 0x09, 0x0F, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 180 <ґ>
+    0x02, 0x08, 0x0A, 0x11, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x01, 0xE7, 0x01, 0xFF, 0x03, 0x3F, 0x03, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 181 <µ>
+    0x02, 0x03, 0x0A, 0x14, 0xF8, 0x03, 0xFE, 0x03, 0x3E, 0x03, 0x3F, 0x03, 0x3F, 0x03, 0x3F, 0x03, 0x3F, 0x03, 0x3E, 0x03, 0x3E, 0x03, 0x38, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x84, 0x01, 0xFE, 0x01, 0x78, 0x00,  // Символ 182 <¶>
+    0x05, 0x0B, 0x04, 0x04, 0x06, 0x0F, 0x0F, 0x06,  // Символ 183 <·>
+    0x02, 0x03, 0x0A, 0x11, 0x9C, 0x03, 0x9C, 0x03, 0x9C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xFC, 0x01, 0x86, 0x01, 0x03, 0x03, 0x03, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0x03, 0x00, 0x03, 0x00, 0x06, 0x01, 0xFE, 0x01, 0xF8, 0x00,  // Символ 184 <ё>
+    0x01, 0x05, 0x0D, 0x0F, 0x63, 0x0E, 0x63, 0x1B, 0x67, 0x1B, 0x67, 0x1B, 0x67, 0x1B, 0x6F, 0x1B, 0x6F, 0x0E, 0x6B, 0x00, 0x7B, 0x1F, 0x7B, 0x00, 0x73, 0x00, 0x73, 0x00, 0x73, 0x00, 0x63, 0x00, 0x63, 0x00,  // Символ 185 <№>
+    0x02, 0x08, 0x0A, 0x0C, 0xF8, 0x01, 0xFC, 0x03, 0x0E, 0x02, 0x07, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x0E, 0x02, 0xFC, 0x03, 0xF8, 0x01,  // Символ 186 <є>
+    0x02, 0x09, 0x0A, 0x09, 0x41, 0x00, 0xC3, 0x00, 0xC7, 0x01, 0x86, 0x01, 0x0C, 0x03, 0x86, 0x01, 0xC7, 0x01, 0xC3, 0x00, 0x41, 0x00,  // Символ 187 <»>
+    0x03, 0x03, 0x08, 0x16, 0xE0, 0xE0, 0xE0, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x61, 0x7F, 0x3E,  // Символ 188 <ј>
+    0x02, 0x05, 0x0A, 0x0F, 0xF8, 0x00, 0xFE, 0x01, 0x07, 0x01, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x1E, 0x00, 0xF8, 0x00, 0xE0, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x81, 0x03, 0xFF, 0x01, 0x7E, 0x00,  // Символ 189 <Ѕ>
+    0x03, 0x08, 0x09, 0x0C, 0x7C, 0x00, 0xFE, 0x00, 0x83, 0x00, 0x03, 0x00, 0x07, 0x00, 0x3E, 0x00, 0xF8, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x81, 0x01, 0xFF, 0x00, 0x7E, 0x00,  // Символ 190 <ѕ>
+    0x03, 0x03, 0x09, 0x11, 0xCE, 0x01, 0xCE, 0x01, 0xCE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xFF, 0x01, 0xFF, 0x01,  // Символ 191 <ї>
+    0x01, 0x05, 0x0C, 0x0F, 0x70, 0x00, 0xD0, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0x98, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x0C, 0x03, 0x04, 0x03, 0x06, 0x03, 0xFE, 0x07, 0xFE, 0x07, 0x03, 0x0E, 0x03, 0x0C, 0x03, 0x0C,  // Символ 192 <А>
+    0x02, 0x05, 0x0A, 0x0F, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x7F, 0x00, 0xFF, 0x01, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x01, 0xFF, 0x01, 0x7F, 0x00,  // Символ 193 <Б>
+    0x02, 0x05, 0x0A, 0x0F, 0x7F, 0x00, 0xFF, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x00, 0x7F, 0x00, 0xFF, 0x01, 0x83, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x01, 0xFF, 0x01, 0x7F, 0x00,  // Символ 194 <В>
+    0x03, 0x05, 0x09, 0x0F, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 195 <Г>
+    0x01, 0x05, 0x0D, 0x12, 0xF0, 0x07, 0xF0, 0x07, 0x30, 0x06, 0x30, 0x06, 0x30, 0x06, 0x38, 0x06, 0x38, 0x06, 0x18, 0x06, 0x18, 0x06, 0x18, 0x06, 0x1C, 0x06, 0x0C, 0x06, 0x0E, 0x06, 0xFF, 0x1F, 0xFF, 0x1F, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18,  // Символ 196 <Д>
+    0x03, 0x05, 0x09, 0x0F, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x01, 0xFF, 0x01,  // Символ 197 <Е>
+    0x00, 0x05, 0x0E, 0x0F, 0xC3, 0x30, 0xC6, 0x18, 0xC6, 0x18, 0xCC, 0x0C, 0xCC, 0x0C, 0xD8, 0x06, 0xF0, 0x03, 0xF0, 0x03, 0xD8, 0x06, 0xD8, 0x06, 0xCC, 0x0C, 0xCC, 0x0C, 0xC6, 0x18, 0xC6, 0x18, 0xC3, 0x30,  // Символ 198 <Ж>
+    0x02, 0x05, 0x0A, 0x0F, 0x7E, 0x00, 0xFF, 0x00, 0xC1, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0x7E, 0x00, 0xFE, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x81, 0x01, 0xFF, 0x01, 0x7E, 0x00,  // Символ 199 <З>
+    0x02, 0x05, 0x0A, 0x0F, 0x03, 0x03, 0x83, 0x03, 0x83, 0x03, 0xC3, 0x03, 0xC3, 0x03, 0x63, 0x03, 0x23, 0x03, 0x33, 0x03, 0x13, 0x03, 0x1B, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x07, 0x03, 0x03, 0x03,  // Символ 200 <И>
+    0x02, 0x02, 0x0A, 0x12, 0x0C, 0x03, 0xF8, 0x01, 0x00, 0x00, 0x03, 0x03, 0x83, 0x03, 0x83, 0x03, 0xC3, 0x03, 0xC3, 0x03, 0x63, 0x03, 0x23, 0x03, 0x33, 0x03, 0x13, 0x03, 0x1B, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x07, 0x03, 0x07, 0x03, 0x03, 0x03,  // Символ 201 <Й>
+    0x02, 0x05, 0x0A, 0x0F, 0x03, 0x03, 0x83, 0x01, 0xC3, 0x00, 0x63, 0x00, 0x73, 0x00, 0x33, 0x00, 0x1B, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x73, 0x00, 0xE3, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x03, 0x03,  // Символ 202 <К>
+    0x02, 0x05, 0x0B, 0x0F, 0xF0, 0x07, 0xF0, 0x07, 0x30, 0x06, 0x30, 0x06, 0x30, 0x06, 0x30, 0x06, 0x38, 0x06, 0x38, 0x06, 0x18, 0x06, 0x18, 0x06, 0x18, 0x06, 0x1C, 0x06, 0x0E, 0x06, 0x0F, 0x06, 0x07, 0x06,  // Символ 203 <Л>
+    0x01, 0x05, 0x0C, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x8F, 0x07, 0x8B, 0x06, 0xDB, 0x06, 0xDB, 0x06, 0x53, 0x06, 0x73, 0x06, 0x23, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x0E, 0x03, 0x0E,  // Символ 204 <М>
+    0x02, 0x05, 0x0B, 0x0F, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0xFF, 0x07, 0xFF, 0x07, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06,  // Символ 205 <Н>
+    0x01, 0x05, 0x0C, 0x0F, 0xF0, 0x01, 0xFC, 0x03, 0x0E, 0x07, 0x06, 0x06, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x06, 0x06, 0x0E, 0x07, 0xFC, 0x03, 0xF8, 0x00,  // Символ 206 <О>
+    0x02, 0x05, 0x0A, 0x0F, 0xFF, 0x03, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 207 <П>
+    0x02, 0x05, 0x0A, 0x0F, 0x7F, 0x00, 0xFF, 0x01, 0x83, 0x01, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x01, 0xFF, 0x00, 0x7F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 208 <Р>
+    0x02, 0x05, 0x0A, 0x0F, 0xF0, 0x01, 0xFC, 0x03, 0x0E, 0x02, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x02, 0xFC, 0x03, 0xF0, 0x01,  // Символ 209 <С>
+    0x01, 0x05, 0x0C, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,  // Символ 210 <Т>
+    0x02, 0x05, 0x0B, 0x0F, 0x03, 0x06, 0x07, 0x06, 0x06, 0x07, 0x0C, 0x03, 0x1C, 0x03, 0x98, 0x01, 0xB8, 0x01, 0xB0, 0x01, 0xF0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x3E, 0x00, 0x1E, 0x00,  // Символ 211 <У>
+    0x01, 0x05, 0x0C, 0x0F, 0x60, 0x00, 0xF8, 0x01, 0xFC, 0x03, 0x6E, 0x07, 0x67, 0x0E, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x67, 0x0E, 0x66, 0x07, 0xFE, 0x03, 0xF8, 0x01, 0x60, 0x00,  // Символ 212 <Ф>
+    0x01, 0x05, 0x0D, 0x0F, 0x0E, 0x1C, 0x0C, 0x0C, 0x18, 0x06, 0x38, 0x07, 0xB0, 0x03, 0xF0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0xE0, 0x01, 0xB0, 0x03, 0x38, 0x03, 0x1C, 0x07, 0x0C, 0x06, 0x0E, 0x0E, 0x07, 0x1C,  // Символ 213 <Х>
+    0x02, 0x05, 0x0B, 0x12, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0x07, 0xFF, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,  // Символ 214 <Ц>
+    0x02, 0x05, 0x0B, 0x0F, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x06, 0x06, 0xFE, 0x07, 0xF8, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,  // Символ 215 <Ч>
+    0x01, 0x05, 0x0C, 0x0F, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFF, 0x0F, 0xFF, 0x0F,  // Символ 216 <Ш>
+    0x01, 0x05, 0x0D, 0x12, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFF, 0x1F, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,  // Символ 217 <Щ>
+    0x01, 0x05, 0x0C, 0x0F, 0x1F, 0x00, 0x1F, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0xF8, 0x01, 0xF8, 0x07, 0x18, 0x0E, 0x18, 0x0C, 0x18, 0x0C, 0x18, 0x0C, 0x18, 0x0E, 0xF8, 0x07, 0xF8, 0x01,  // Символ 218 <Ъ>
+    0x02, 0x05, 0x0B, 0x0F, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x3F, 0x06, 0x7F, 0x06, 0xE3, 0x06, 0xC3, 0x06, 0xC3, 0x06, 0xC3, 0x06, 0xE3, 0x06, 0x7F, 0x06, 0x3F, 0x06,  // Символ 219 <Ы>
+    0x02, 0x05, 0x0A, 0x0F, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x7F, 0x00, 0xFF, 0x01, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x01, 0xFF, 0x01, 0x7F, 0x00,  // Символ 220 <Ь>
+    0x02, 0x05, 0x0A, 0x0F, 0x3E, 0x00, 0xFF, 0x00, 0xC1, 0x01, 0x80, 0x01, 0x00, 0x03, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x01, 0xC1, 0x01, 0xFF, 0x00, 0x3E, 0x00,  // Символ 221 <Э>
+    0x01, 0x05, 0x0C, 0x0F, 0xC3, 0x03, 0xE3, 0x07, 0x63, 0x06, 0x33, 0x0C, 0x33, 0x0C, 0x33, 0x0C, 0x3F, 0x0C, 0x3F, 0x0C, 0x33, 0x0C, 0x33, 0x0C, 0x33, 0x0C, 0x33, 0x0C, 0x63, 0x06, 0xE3, 0x07, 0xC3, 0x03,  // Символ 222 <Ю>
+    0x02, 0x05, 0x0A, 0x0F, 0xF8, 0x03, 0xFC, 0x03, 0x0E, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x0E, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0x1C, 0x03, 0x0C, 0x03, 0x0E, 0x03, 0x06, 0x03, 0x06, 0x03, 0x07, 0x03,  // Символ 223 <Я>
+    0x02, 0x08, 0x0A, 0x0C, 0xFC, 0x00, 0xFE, 0x01, 0x82, 0x03, 0x00, 0x03, 0x00, 0x03, 0xFC, 0x03, 0xFE, 0x03, 0x07, 0x03, 0x03, 0x03, 0xC3, 0x03, 0xFF, 0x03, 0x7C, 0x03,  // Символ 224 <а>
+    0x02, 0x03, 0x0B, 0x11, 0xE0, 0x03, 0xF8, 0x03, 0x1C, 0x00, 0x06, 0x00, 0x06, 0x00, 0xF3, 0x00, 0xFB, 0x03, 0x0F, 0x03, 0x07, 0x07, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x06, 0x07, 0x8E, 0x03, 0xFC, 0x01, 0xF8, 0x00,  // Символ 225 <б>
+    0x02, 0x08, 0x0A, 0x0C, 0x7F, 0x00, 0xFF, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xFF, 0x00, 0xFF, 0x01, 0x83, 0x03, 0x03, 0x03, 0x83, 0x03, 0xFF, 0x01, 0xFF, 0x00,  // Символ 226 <в>
+    0x03, 0x08, 0x08, 0x0C, 0xFF, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 227 <г>
+    0x01, 0x08, 0x0C, 0x0F, 0xF8, 0x03, 0xF8, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x18, 0x03, 0x1C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x06, 0x03, 0xFF, 0x0F, 0xFF, 0x0F, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C,  // Символ 228 <д>
+    0x02, 0x08, 0x0A, 0x0C, 0x78, 0x00, 0xFC, 0x01, 0x86, 0x01, 0x03, 0x03, 0x03, 0x03, 0xFF, 0x03, 0xFF, 0x03, 0x03, 0x00, 0x03, 0x00, 0x06, 0x01, 0xFE, 0x01, 0xF8, 0x00,  // Символ 229 <е>
+    0x00, 0x08, 0x0E, 0x0C, 0xC3, 0x30, 0xC6, 0x18, 0xCC, 0x0C, 0xCC, 0x0C, 0xD8, 0x06, 0xF0, 0x03, 0xF0, 0x03, 0xD8, 0x06, 0xCC, 0x0C, 0xCC, 0x0C, 0xC6, 0x18, 0xC7, 0x38,  // Символ 230 <ж>
+    0x02, 0x08, 0x0A, 0x0C, 0x7E, 0x00, 0xFF, 0x01, 0x81, 0x01, 0x80, 0x01, 0x80, 0x01, 0xFC, 0x00, 0xFC, 0x01, 0x80, 0x03, 0x00, 0x03, 0x81, 0x03, 0xFF, 0x01, 0xFE, 0x00,  // Символ 231 <з>
+    0x03, 0x08, 0x09, 0x0C, 0x83, 0x01, 0xC3, 0x01, 0xC3, 0x01, 0xE3, 0x01, 0xB3, 0x01, 0xB3, 0x01, 0x9B, 0x01, 0x9B, 0x01, 0x8F, 0x01, 0x87, 0x01, 0x87, 0x01, 0x83, 0x01,  // Символ 232 <и>
+    0x03, 0x03, 0x09, 0x11, 0xC6, 0x00, 0xC6, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0xC3, 0x01, 0xC3, 0x01, 0xE3, 0x01, 0xB3, 0x01, 0xB3, 0x01, 0x9B, 0x01, 0x9B, 0x01, 0x8F, 0x01, 0x87, 0x01, 0x87, 0x01, 0x83, 0x01,  // Символ 233 <й>
+    0x02, 0x08, 0x0A, 0x0C, 0x83, 0x01, 0xC3, 0x00, 0x63, 0x00, 0x33, 0x00, 0x1B, 0x00, 0x0F, 0x00, 0x1B, 0x00, 0x33, 0x00, 0x63, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x03, 0x03,  // Символ 234 <к>
+    0x02, 0x08, 0x0B, 0x0C, 0xF0, 0x07, 0xF0, 0x07, 0x30, 0x06, 0x30, 0x06, 0x30, 0x06, 0x38, 0x06, 0x18, 0x06, 0x18, 0x06, 0x18, 0x06, 0x1C, 0x06, 0x0F, 0x06, 0x07, 0x06,  // Символ 235 <л>
+    0x02, 0x08, 0x0B, 0x0C, 0x07, 0x07, 0x07, 0x07, 0x8D, 0x07, 0x8D, 0x07, 0xD9, 0x06, 0xD9, 0x06, 0x51, 0x06, 0x71, 0x06, 0x31, 0x06, 0x01, 0x06, 0x01, 0x06, 0x01, 0x06,  // Символ 236 <м>
+    0x03, 0x08, 0x09, 0x0C, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xFF, 0x01, 0xFF, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,  // Символ 237 <н>
+    0x02, 0x08, 0x0B, 0x0C, 0xF8, 0x00, 0xFC, 0x03, 0x8E, 0x03, 0x07, 0x07, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x07, 0x07, 0x8E, 0x03, 0xFE, 0x01, 0xF8, 0x00,  // Символ 238 <о>
+    0x03, 0x08, 0x09, 0x0C, 0xFF, 0x01, 0xFF, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,  // Символ 239 <п>
+    0x02, 0x08, 0x0A, 0x11, 0xF3, 0x00, 0xFF, 0x01, 0x8F, 0x01, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x03, 0xC3, 0x01, 0xFF, 0x00, 0x7F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 240 <р>
+    0x03, 0x08, 0x09, 0x0C, 0xF8, 0x00, 0xFC, 0x01, 0x0E, 0x01, 0x07, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x07, 0x00, 0x0E, 0x01, 0xFE, 0x01, 0xF8, 0x00,  // Символ 241 <с>
+    0x02, 0x08, 0x0A, 0x0C, 0xFF, 0x03, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,  // Символ 242 <т>
+    0x01, 0x08, 0x0C, 0x11, 0x06, 0x0C, 0x06, 0x0C, 0x0E, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x18, 0x03, 0x18, 0x03, 0xB8, 0x01, 0xB0, 0x01, 0xB0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1F, 0x00, 0x0F, 0x00,  // Символ 243 <у>
+    0x01, 0x03, 0x0C, 0x16, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0xF8, 0x01, 0xFC, 0x07, 0x6E, 0x06, 0x67, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x67, 0x0E, 0x66, 0x07, 0xFE, 0x03, 0xF8, 0x01, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,  // Символ 244 <ф>
+    0x02, 0x08, 0x0B, 0x0C, 0x07, 0x07, 0x0E, 0x03, 0x8C, 0x01, 0xDC, 0x01, 0xF8, 0x00, 0x70, 0x00, 0x70, 0x00, 0xD8, 0x00, 0xDC, 0x01, 0x8C, 0x01, 0x8E, 0x03, 0x07, 0x07,  // Символ 245 <х>
+    0x02, 0x08, 0x0B, 0x0F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0x07, 0xFF, 0x07, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06,  // Символ 246 <ц>
+    0x02, 0x08, 0x0A, 0x0C, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x03, 0xFE, 0x03, 0xFC, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,  // Символ 247 <ч>
+    0x01, 0x08, 0x0C, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFF, 0x0F, 0xFF, 0x0F,  // Символ 248 <ш>
+    0x01, 0x08, 0x0D, 0x0F, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFF, 0x1F, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,  // Символ 249 <щ>
+    0x01, 0x08, 0x0C, 0x0C, 0x1F, 0x00, 0x1F, 0x00, 0x18, 0x00, 0x18, 0x00, 0xF8, 0x03, 0xF8, 0x07, 0x18, 0x0E, 0x18, 0x0C, 0x18, 0x0C, 0x18, 0x0E, 0xF8, 0x07, 0xF8, 0x03,  // Символ 250 <ъ>
+    0x02, 0x08, 0x0B, 0x0C, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0x06, 0x3F, 0x06, 0x7F, 0x06, 0xE3, 0x06, 0xC3, 0x06, 0xC3, 0x06, 0xE3, 0x06, 0x7F, 0x06, 0x3F, 0x06,  // Символ 251 <ы>
+    0x02, 0x08, 0x0A, 0x0C, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xFF, 0x00, 0xFF, 0x01, 0x83, 0x03, 0x03, 0x03, 0x03, 0x03, 0x83, 0x03, 0xFF, 0x01, 0xFF, 0x00,  // Символ 252 <ь>
+    0x02, 0x08, 0x0A, 0x0C, 0x7E, 0x00, 0xFF, 0x00, 0xC1, 0x01, 0x80, 0x03, 0x00, 0x03, 0xFE, 0x03, 0xFE, 0x03, 0x00, 0x03, 0x00, 0x03, 0xC1, 0x01, 0xFF, 0x00, 0x7E, 0x00,  // Символ 253 <э>
+    0x01, 0x08, 0x0C, 0x0C, 0xC3, 0x03, 0xE3, 0x07, 0x73, 0x0E, 0x33, 0x0C, 0x33, 0x0C, 0x3F, 0x0C, 0x3F, 0x0C, 0x33, 0x0C, 0x33, 0x0C, 0x73, 0x0E, 0xE3, 0x07, 0xC3, 0x03,  // Символ 254 <ю>
+    0x02, 0x08, 0x0A, 0x0C, 0xF8, 0x03, 0xFC, 0x03, 0x0E, 0x03, 0x06, 0x03, 0x06, 0x03, 0x0E, 0x03, 0xFC, 0x03, 0xF8, 0x03, 0x0C, 0x03, 0x06, 0x03, 0x06, 0x03, 0x07, 0x03   // Символ 255 <я>
+};
+
+// смещения матриц символов 32..255
+const uint16_t font_consolas_18_boxidx[224] =
+{
+        0,     4,    25,    35,    69,   115,   153,   191,   201,   227,   253,   277,   305,   317,   323,   331,
+      375,   409,   443,   477,   511,   545,   579,   613,   647,   681,   715,   731,   751,   781,   797,   827,
+      848,   896,   930,   964,   998,  1032,  1066,  1100,  1134,  1168,  1202,  1221,  1255,  1289,  1323,  1357,
+     1391,  1425,  1467,  1501,  1535,  1569,  1603,  1637,  1671,  1705,  1739,  1773,  1799,  1843,  1869,  1887,
+     1895,  1902,  1930,  1968,  1996,  2034,  2062,  2100,  2138,  2176,  2214,  2240,  2278,  2316,  2344,  2372,
+     2400,  2438,  2476,  2504,  2532,  2568,  2596,  2624,  2652,  2680,  2718,  2746,  2772,  2800,  2826,  2840,
+     2858,  2892,  2936,  2948,  2969,  2987,  2997,  3015,  3036,  3070,  3108,  3142,  3156,  3190,  3234,  3268,
+     3308,  3356,  3368,  3380,  3398,  3416,  3427,  3435,  3443,  3447,  3463,  3491,  3505,  3533,  3571,  3609,
+     3643,  3647,  3687,  3735,  3754,  3786,  3826,  3854,  3898,  3942,  3976,  4010,  4032,  4046,  4052,  4078,
+     4122,  4134,  4166,  4200,  4238,  4272,  4310,  4354,  4362,  4400,  4434,  4462,  4484,  4510,  4544,  4572,
+     4610,  4644,  4678,  4712,  4746,  4786,  4820,  4854,  4888,  4922,  4962,  4996,  5030,  5064,  5098,  5132,
+     5166,  5200,  5234,  5268,  5302,  5336,  5370,  5410,  5444,  5478,  5518,  5552,  5586,  5620,  5654,  5688,
+     5722,  5750,  5788,  5816,  5832,  5866,  5894,  5922,  5950,  5978,  6016,  6044,  6072,  6100,  6128,  6156,
+     6184,  6222,  6250,  6278,  6316,  6364,  6392,  6426,  6454,  6482,  6516,  6544,  6572,  6600,  6628,  6656
+};
+
+// описание шрифта для print_char_font()
+const st7735_font fd_consolas_18_box = { font_consolas_18_box, font_consolas_18_boxidx, 0, 15, 26, 32, 224, BITS_RB, ST7735_FONT_BOX };
+
+#endif // FONT_CONSOLAS_18_BOX_H
@@ -8,6 +8,8 @@
 #ifndef FONT_CONSOLAS_18_H
 #define FONT_CONSOLAS_18_H
 
+#include "lcd7735sl.h"
+
 #ifndef FONT_TYPE_MONOSPACED
 #define FONT_TYPE_MONOSPACED            0
 #endif
@@ -264,263 +266,8 @@ const unsigned char  font_consolas_18[FONT_CONSOLAS_18_ARRAY_LENGTH] =
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0xF0, 0x0F, 0x38, 0x0C, 0x18, 0x0C, 0x18, 0x0C, 0x38, 0x0C, 0xF0, 0x0F, 0xE0, 0x0F, 0x30, 0x0C, 0x18, 0x0C, 0x18, 0x0C, 0x1C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  // Символ 255 <я> 
 };
 
-const unsigned int font_consolas_18idx[255] = {
-52	,
-104	,
-156	,
-208	,
-260	,
-312	,
-364	,
-416	,
-468	,
-520	,
-572	,
-624	,
-676	,
-728	,
-780	,
-832	,
-884	,
-936	,
-988	,
-1040	,
-1092	,
-1144	,
-1196	,
-1248	,
-1300	,
-1352	,
-1404	,
-1456	,
-1508	,
-1560	,
-1612	,
-1664	,
-1716	,
-1768	,
-1820	,
-1872	,
-1924	,
-1976	,
-2028	,
-2080	,
-2132	,
-2184	,
-2236	,
-2288	,
-2340	,
-2392	,
-2444	,
-2496	,
-2548	,
-2600	,
-2652	,
-2704	,
-2756	,
-2808	,
-2860	,
-2912	,
-2964	,
-3016	,
-3068	,
-3120	,
-3172	,
-3224	,
-3276	,
-3328	,
-3380	,
-3432	,
-3484	,
-3536	,
-3588	,
-3640	,
-3692	,
-3744	,
-3796	,
-3848	,
-3900	,
-3952	,
-4004	,
-4056	,
-4108	,
-4160	,
-4212	,
-4264	,
-4316	,
-4368	,
-4420	,
-4472	,
-4524	,
-4576	,
-4628	,
-4680	,
-4732	,
-4784	,
-4836	,
-4888	,
-4940	,
-4992	,
-5044	,
-5096	,
-5148	,
-5200	,
-5252	,
-5304	,
-5356	,
-5408	,
-5460	,
-5512	,
-5564	,
-5616	,
-5668	,
-5720	,
-5772	,
-5824	,
-5876	,
-5928	,
-5980	,
-6032	,
-6084	,
-6136	,
-6188	,
-6240	,
-6292	,
-6344	,
-6396	,
-6448	,
-6500	,
-6552	,
-6604	,
-6656	,
-6708	,
-6760	,
-6812	,
-6864	,
-6916	,
-6968	,
-7020	,
-7072	,
-7124	,
-7176	,
-7228	,
-7280	,
-7332	,
-7384	,
-7436	,
-7488	,
-7540	,
-7592	,
-7644	,
-7696	,
-7748	,
-7800	,
-7852	,
-7904	,
-7956	,
-8008	,
-8060	,
-8112	,
-8164	,
-8216	,
-8268	,
-8320	,
-8372	,
-8424	,
-8476	,
-8528	,
-8580	,
-8632	,
-8684	,
-8736	,
-8788	,
-8840	,
-8892	,
-8944	,
-8996	,
-9048	,
-9100	,
-9152	,
-9204	,
-9256	,
-9308	,
-9360	,
-9412	,
-9464	,
-9516	,
-9568	,
-9620	,
-9672	,
-9724	,
-9776	,
-9828	,
-9880	,
-9932	,
-9984	,
-10036	,
-10088	,
-10140	,
-10192	,
-10244	,
-10296	,
-10348	,
-10400	,
-10452	,
-10504	,
-10556	,
-10608	,
-10660	,
-10712	,
-10764	,
-10816	,
-10868	,
-10920	,
-10972	,
-11024	,
-11076	,
-11128	,
-11180	,
-11232	,
-11284	,
-11336	,
-11388	,
-11440	,
-11492	,
-11544	,
-11596	,
-11648	,
-11700	,
-11752	,
-11804	,
-11856	,
-11908	,
-11960	,
-12012	,
-12064	,
-12116	,
-12168	,
-12220	,
-12272	,
-12324	,
-12376	,
-12428	,
-12480	,
-12532	,
-12584	,
-12636	,
-12688	,
-12740	,
-12792	,
-12844	,
-12896	,
-12948	,
-13000	,
-13052	,
-13104	,
-13156	,
-13208	
-
-};
-
+// описание шрифта для print_char_font()
+const st7735_font fd_consolas_18 = { font_consolas_18, 0, FONT_CONSOLAS_18_CHAR_HEIGHT * 2, FONT_CONSOLAS_18_CHAR_WIDTH, FONT_CONSOLAS_18_CHAR_HEIGHT,
+                                      FONT_CONSOLAS_18_START_CHAR, FONT_CONSOLAS_18_LENGTH, BITS_RB, 0 };
 
 #endif // FONT_CONSOLAS_18_H 
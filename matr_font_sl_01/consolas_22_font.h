@@ -8,6 +8,8 @@
 #ifndef FONT_CONSOLAS_22_H
 #define FONT_CONSOLAS_22_H
 
+#include "lcd7735sl.h"
+
 #ifndef FONT_TYPE_MONOSPACED
 #define FONT_TYPE_MONOSPACED            0
 #endif
@@ -260,263 +262,8 @@ const unsigned char  font_consolas_22[FONT_CONSOLAS_22_ARRAY_LENGTH] =
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x1F, 0x00, 0x38, 0x3C, 0x00, 0x38, 0x78, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x38, 0x00, 0x38, 0x3C, 0x00, 0xF8, 0x1F, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  // Символ 255 <Ъ> 
 };
 
-const unsigned int font_consolas_22idx[255] = {
-
-0	,
-102	,
-204	,
-306	,
-408	,
-510	,
-612	,
-714	,
-816	,
-918	,
-1020	,
-1122	,
-1224	,
-1326	,
-1428	,
-1530	,
-1632	,
-1734	,
-1836	,
-1938	,
-2040	,
-2142	,
-2244	,
-2346	,
-2448	,
-2550	,
-2652	,
-2754	,
-2856	,
-2958	,
-3060	,
-3162	,
-3264	,
-3366	,
-3468	,
-3570	,
-3672	,
-3774	,
-3876	,
-3978	,
-4080	,
-4182	,
-4284	,
-4386	,
-4488	,
-4590	,
-4692	,
-4794	,
-4896	,
-4998	,
-5100	,
-5202	,
-5304	,
-5406	,
-5508	,
-5610	,
-5712	,
-5814	,
-5916	,
-6018	,
-6120	,
-6222	,
-6324	,
-6426	,
-6528	,
-6630	,
-6732	,
-6834	,
-6936	,
-7038	,
-7140	,
-7242	,
-7344	,
-7446	,
-7548	,
-7650	,
-7752	,
-7854	,
-7956	,
-8058	,
-8160	,
-8262	,
-8364	,
-8466	,
-8568	,
-8670	,
-8772	,
-8874	,
-8976	,
-9078	,
-9180	,
-9282	,
-9384	,
-9486	,
-9588	,
-9690	,
-9792	,
-9894	,
-9996	,
-10098	,
-10200	,
-10302	,
-10404	,
-10506	,
-10608	,
-10710	,
-10812	,
-10914	,
-11016	,
-11118	,
-11220	,
-11322	,
-11424	,
-11526	,
-11628	,
-11730	,
-11832	,
-11934	,
-12036	,
-12138	,
-12240	,
-12342	,
-12444	,
-12546	,
-12648	,
-12750	,
-12852	,
-12954	,
-13056	,
-13158	,
-13260	,
-13362	,
-13464	,
-13566	,
-13668	,
-13770	,
-13872	,
-13974	,
-14076	,
-14178	,
-14280	,
-14382	,
-14484	,
-14586	,
-14688	,
-14790	,
-14892	,
-14994	,
-15096	,
-15198	,
-15300	,
-15402	,
-15504	,
-15606	,
-15708	,
-15810	,
-15912	,
-16014	,
-16116	,
-16218	,
-16320	,
-16422	,
-16524	,
-16626	,
-16728	,
-16830	,
-16932	,
-17034	,
-17136	,
-17238	,
-17340	,
-17442	,
-17544	,
-17646	,
-17748	,
-17850	,
-17952	,
-18054	,
-18156	,
-18258	,
-18360	,
-18462	,
-18564	,
-18666	,
-18768	,
-18870	,
-18972	,
-19074	,
-19176	,
-19278	,
-19380	,
-19482	,
-19584	,
-19686	,
-19788	,
-19890	,
-19992	,
-20094	,
-20196	,
-20298	,
-20400	,
-20502	,
-20604	,
-20706	,
-20808	,
-20910	,
-21012	,
-21114	,
-21216	,
-21318	,
-21420	,
-21522	,
-21624	,
-21726	,
-21828	,
-21930	,
-22032	,
-22134	,
-22236	,
-22338	,
-22440	,
-22542	,
-22644	,
-22746	,
-22848	,
-22950	,
-23052	,
-23154	,
-23256	,
-23358	,
-23460	,
-23562	,
-23664	,
-23766	,
-23868	,
-23970	,
-24072	,
-24174	,
-24276	,
-24378	,
-24480	,
-24582	,
-24684	,
-24786	,
-24888	,
-24990	,
-25092	,
-25194	,
-25296	,
-25398	,
-25500	,
-25602	,
-25704	,
-25806
-};
-
+// описание шрифта для print_char_font()
+const st7735_font fd_consolas_22 = { font_consolas_22, 0, FONT_CONSOLAS_22_CHAR_HEIGHT * 3, FONT_CONSOLAS_22_CHAR_WIDTH, FONT_CONSOLAS_22_CHAR_HEIGHT,
+                                      FONT_CONSOLAS_22_START_CHAR, FONT_CONSOLAS_22_LENGTH, BITS_RB, 0 };
 
 #endif // FONT_CONSOLAS_22_H 
@@ -0,0 +1,260 @@
+// Consolas 22 (из consolas_22_font.h), сжатый формат BITS_RLE: для каждого символа
+// пары отрезков фон/цвет построчно подряд, см. print_char_rle() в lcd7735sl.c
+// 8693 байт матриц + 448 байт смещений вместо 22848, сгенерировано tools/fontc
+
+#ifndef FONT_CONSOLAS_22_RLE_H
+#define FONT_CONSOLAS_22_RLE_H
+
+#include "lcd7735sl.h"
+
+const unsigned char font_consolas_22_rle[8693] =
+{
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x39,  // Символ 32 < >
+    0xF3, 0x6F, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF2, 0x25, 0xF4, 0x00, 0xE4, 0xF2, 0x00, 0xF0, 0x7E,  // Символ 33 <!>
+    0xF3, 0x6F, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xF0, 0xFF, 0xF0, 0x55,  // Символ 34 <">
+    0xF2, 0x86, 0x23, 0xB2, 0x23, 0xB2, 0x23, 0xB2, 0x23, 0xB2, 0x23, 0x7E, 0x4E, 0x73, 0x13, 0xB3, 0x13, 0xB3, 0x13, 0xB2, 0x23, 0xB2, 0x23, 0x7E, 0x4E, 0x82, 0x23, 0xA3, 0x13, 0xB3, 0x13, 0xB3, 0x13, 0xB3, 0x13, 0xF0, 0x77,  // Символ 35 <#>
+    0xF2, 0x64, 0xF2, 0x01, 0xF2, 0x01, 0xD7, 0x9A, 0x73, 0x23, 0x21, 0x63, 0x32, 0xA3, 0x32, 0xA3, 0x32, 0xA4, 0x22, 0xB7, 0xD6, 0xE6, 0xC2, 0x14, 0xB2, 0x24, 0xA2, 0x33, 0xA2, 0x33, 0xA2, 0x33, 0x51, 0x42, 0x23, 0x6B, 0x97, 0xD2, 0xF2, 0x01, 0xF2, 0x01, 0xF0, 0x45,  // Символ 36 <$>
+    0xF5, 0x72, 0x52, 0x57, 0x32, 0x53, 0x33, 0x13, 0x53, 0x33, 0x12, 0x63, 0x35, 0x73, 0x35, 0x89, 0xA7, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0x35, 0x73, 0x27, 0x62, 0x23, 0x33, 0x42, 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x43, 0x33, 0x22, 0x67, 0x23, 0x75, 0xF0, 0x72,  // Символ 37 <%>
+    0xF5, 0x74, 0xB8, 0x94, 0x24, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x33, 0xA3, 0x13, 0xB6, 0xC4, 0xD6, 0x33, 0x53, 0x23, 0x23, 0x43, 0x33, 0x23, 0x43, 0x43, 0x12, 0x53, 0x55, 0x53, 0x55, 0x53, 0x63, 0x73, 0x45, 0x69, 0x13, 0x75, 0x34, 0xF0, 0x72,  // Символ 38 <&>
+    0xF3, 0x6F, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0xFF, 0xF0, 0x5A,  // Символ 39 <'>
+    0xF1, 0x64, 0xF3, 0x01, 0xE3, 0xE3, 0xE3, 0xE3, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x01, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x01, 0xF4, 0x00, 0xF3, 0x00, 0xF3, 0x01, 0xF3, 0x01, 0xF3, 0x01, 0xF1, 0x01, 0xF0, 0x0D,  // Символ 40 <(>
+    0xF1, 0x5E, 0xF3, 0x01, 0xF3, 0x01, 0xF3, 0x01, 0xF3, 0x00, 0xF3, 0x01, 0xF3, 0x00, 0xF3, 0x01, 0xF3, 0x00, 0xF4, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xE3, 0xE3, 0xF1, 0x01, 0xF0, 0x13,  // Символ 41 <)>
+    0xF2, 0x74, 0xF2, 0x01, 0xC1, 0x32, 0x31, 0x73, 0x22, 0x23, 0x89, 0xB4, 0xE4, 0xC8, 0x83, 0x22, 0x23, 0x71, 0x32, 0x31, 0xC2, 0xF2, 0x01, 0xF0, 0xFF, 0xB0,  // Символ 42 <*>
+    0xF3, 0xCF, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x9F, 0x3F, 0x93, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x8A,  // Символ 43 <+>
+    0xF0, 0xFF, 0xF3, 0x84, 0xE5, 0xD5, 0xE4, 0xE4, 0xE4, 0xD4, 0xC5, 0xD3, 0xF0, 0x24,  // Символ 44 <,>
+    0xF0, 0xFF, 0xF8, 0x27, 0xA8, 0xF0, 0xF7,  // Символ 45 <->
+    0xF0, 0xFF, 0xF3, 0x70, 0xE5, 0xD5, 0xD5, 0xE3, 0xF0, 0x7D,  // Символ 46 <.>
+    0xF2, 0x79, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF2, 0x01, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF2, 0x01, 0xF2, 0x00, 0xF2, 0x01, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF2, 0x01, 0xF2, 0x00, 0xF2, 0x01, 0xF3, 0x00, 0xF0, 0x48,  // Символ 47 </>
+    0xF6, 0x85, 0xB8, 0x93, 0x43, 0x73, 0x63, 0x63, 0x63, 0x53, 0x74, 0x43, 0x65, 0x43, 0x52, 0x13, 0x43, 0x42, 0x23, 0x43, 0x32, 0x33, 0x43, 0x22, 0x43, 0x43, 0x12, 0x53, 0x45, 0x63, 0x44, 0x73, 0x53, 0x63, 0x63, 0x63, 0x73, 0x43, 0x98, 0xB6, 0xF0, 0x77,  // Символ 48 <0>
+    0xF4, 0x86, 0xC6, 0xA4, 0x13, 0x94, 0x23, 0xA1, 0x43, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xAC, 0x6C, 0xF0, 0x74,  // Символ 49 <1>
+    0xF5, 0x84, 0xB8, 0x93, 0x43, 0x91, 0x63, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xE3, 0xF2, 0x00, 0xFC, 0x00, 0x6C, 0xF0, 0x75,  // Символ 50 <2>
+    0xF6, 0x83, 0xB9, 0x91, 0x54, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xD4, 0xA6, 0xC8, 0xF4, 0x00, 0xF4, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xE4, 0x7A, 0x87, 0xF0, 0x7A,  // Символ 51 <3>
+    0xF4, 0x89, 0xD5, 0xC6, 0xC2, 0x13, 0xB3, 0x13, 0xB2, 0x23, 0xA2, 0x33, 0x93, 0x33, 0x92, 0x43, 0x83, 0x43, 0x82, 0x53, 0x72, 0x63, 0x63, 0x63, 0x6F, 0x3F, 0xC3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x75,  // Символ 52 <4>
+    0xFB, 0x81, 0x7B, 0x73, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF8, 0x00, 0xAA, 0xF4, 0x00, 0xF4, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xE4, 0x79, 0x97, 0xF0, 0x7A,  // Символ 53 <5>
+    0xF6, 0x87, 0xA8, 0x94, 0xD3, 0xE3, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0x16, 0x8C, 0x64, 0x53, 0x63, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x54, 0x63, 0x63, 0x53, 0x74, 0x34, 0x89, 0xB5, 0xF0, 0x78,  // Символ 54 <6>
+    0xFD, 0x81, 0x5D, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xE3, 0xF0, 0x7C,  // Символ 55 <7>
+    0xF7, 0x84, 0xAA, 0x73, 0x54, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x63, 0x53, 0x75, 0x23, 0xA7, 0xB7, 0xA3, 0x24, 0x83, 0x53, 0x63, 0x64, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x63, 0x53, 0x7A, 0xA7, 0xF0, 0x77,  // Символ 56 <8>
+    0xF5, 0x85, 0xB9, 0x84, 0x34, 0x73, 0x53, 0x63, 0x63, 0x63, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x63, 0x54, 0x6C, 0x86, 0x13, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xE3, 0xD4, 0x98, 0xA6, 0xF0, 0x7A,  // Символ 57 <9>
+    0xF2, 0xDC, 0xF4, 0x00, 0xE4, 0xF2, 0x00, 0xF2, 0x6D, 0xF4, 0x00, 0xE4, 0xF2, 0x00, 0xF0, 0x7E,  // Символ 58 <:>
+    0xF2, 0xDE, 0xF4, 0x00, 0xE4, 0xF2, 0x00, 0xF3, 0x6D, 0xE5, 0xD5, 0xE4, 0xE4, 0xE4, 0xD4, 0xC5, 0xD3, 0xF0, 0x24,  // Символ 59 <;>
+    0xF1, 0xBF, 0xF3, 0x01, 0xE3, 0xD4, 0xD3, 0xE3, 0xE3, 0xE3, 0xF3, 0x00, 0xF3, 0x01, 0xF3, 0x01, 0xF3, 0x01, 0xF4, 0x01, 0xF3, 0x01, 0xF3, 0x01, 0xF1, 0x01, 0xF0, 0x78,  // Символ 60 <<>
+    0xF0, 0xFF, 0xFC, 0x03, 0x6C, 0xFC, 0x2D, 0x6C, 0xF0, 0xBD,  // Символ 61 <=>
+    0xF1, 0xB8, 0xF3, 0x01, 0xF3, 0x01, 0xF4, 0x01, 0xF3, 0x01, 0xF3, 0x01, 0xF3, 0x01, 0xF3, 0x01, 0xF3, 0x00, 0xE3, 0xE3, 0xE3, 0xD4, 0xD3, 0xE3, 0xF1, 0x01, 0xF0, 0x7F,  // Символ 62 <>>
+    0xF4, 0x6F, 0xE6, 0xF4, 0x00, 0xF3, 0x01, 0xF3, 0x01, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE4, 0xB6, 0xC5, 0xD3, 0xF3, 0x00, 0xF3, 0x00, 0xF2, 0x24, 0xF4, 0x00, 0xE4, 0xF2, 0x00, 0xF0, 0x7D,  // Символ 63 <?>
+    0xF5, 0x76, 0xB8, 0x93, 0x43, 0x73, 0x63, 0x62, 0x82, 0x52, 0x93, 0x42, 0xA2, 0x32, 0x45, 0x22, 0x32, 0x36, 0x22, 0x32, 0x23, 0x13, 0x22, 0x22, 0x32, 0x23, 0x22, 0x22, 0x23, 0x22, 0x32, 0x22, 0x23, 0x22, 0x32, 0x22, 0x23, 0x22, 0x32, 0x22, 0x23, 0x22, 0x32, 0x22, 0x23, 0x22, 0x22, 0x32, 0x23, 0x13, 0x22, 0x32, 0x2A, 0x42, 0x33, 0x23, 0x52, 0xF2, 0x02, 0xF2, 0x01, 0xF3, 0x01, 0xF3, 0x01, 0x61, 0x99, 0xA6, 0xF0, 0x0B,  // Символ 64 <@>
+    0xF3, 0x87, 0xE5, 0xD2, 0x12, 0xD2, 0x12, 0xC3, 0x13, 0xB2, 0x32, 0xB2, 0x32, 0xA3, 0x33, 0x92, 0x52, 0x92, 0x52, 0x83, 0x53, 0x72, 0x63, 0x72, 0x72, 0x6D, 0x5D, 0x52, 0x92, 0x43, 0x93, 0x33, 0x93, 0x32, 0xB2, 0xF0, 0x72,  // Символ 65 <A>
+    0xF8, 0x81, 0xAA, 0x83, 0x44, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x43, 0x89, 0x9A, 0x83, 0x44, 0x73, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x7A, 0x88, 0xF0, 0x79,  // Символ 66 <B>
+    0xF7, 0x86, 0x9A, 0x74, 0x61, 0x73, 0xE3, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x61, 0x8A, 0xA7, 0xF0, 0x75,  // Символ 67 <C>
+    0xF9, 0x81, 0x9B, 0x73, 0x54, 0x63, 0x64, 0x53, 0x73, 0x53, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x73, 0x53, 0x73, 0x53, 0x63, 0x63, 0x54, 0x6A, 0x88, 0xF0, 0x79,  // Символ 68 <D>
+    0xFB, 0x81, 0x7B, 0x73, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xFB, 0x00, 0x7B, 0x73, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xFB, 0x00, 0x7B, 0xF0, 0x76,  // Символ 69 <E>
+    0xFA, 0x81, 0x8A, 0x83, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xFA, 0x00, 0x8A, 0x83, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x7E,  // Символ 70 <F>
+    0xF7, 0x87, 0x9A, 0x74, 0x61, 0x63, 0xE3, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x47, 0x43, 0x47, 0x43, 0x83, 0x43, 0x83, 0x53, 0x73, 0x53, 0x73, 0x54, 0x63, 0x64, 0x53, 0x7B, 0x97, 0xF0, 0x75,  // Символ 71 <G>
+    0xF3, 0x81, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6C, 0x6C, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xF0, 0x75,  // Символ 72 <H>
+    0xFB, 0x81, 0x7B, 0xB3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xBB, 0x7B, 0xF0, 0x76,  // Символ 73 <I>
+    0xFA, 0x81, 0x8A, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x81, 0x53, 0x98, 0xB6, 0xF0, 0x7A,  // Символ 74 <J>
+    0xF3, 0x81, 0x73, 0x53, 0x63, 0x63, 0x53, 0x73, 0x43, 0x83, 0x42, 0x93, 0x33, 0x93, 0x23, 0xA3, 0x13, 0xB3, 0x12, 0xC6, 0xC3, 0x12, 0xC3, 0x13, 0xB3, 0x23, 0xA3, 0x33, 0x93, 0x43, 0x83, 0x43, 0x83, 0x53, 0x73, 0x63, 0x63, 0x73, 0xF0, 0x74,  // Символ 75 <K>
+    0xF3, 0x81, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xFB, 0x00, 0x7B, 0xF0, 0x76,  // Символ 76 <L>
+    0xF3, 0x82, 0x64, 0x53, 0x64, 0x53, 0x64, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x41, 0x22, 0x42, 0x22, 0x22, 0x22, 0x42, 0x22, 0x22, 0x22, 0x42, 0x22, 0x21, 0x32, 0x42, 0x34, 0x32, 0x42, 0x34, 0x32, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0xF0, 0x73,  // Символ 77 <M>
+    0xF4, 0x81, 0x53, 0x64, 0x53, 0x65, 0x43, 0x65, 0x43, 0x65, 0x43, 0x63, 0x12, 0x33, 0x63, 0x12, 0x33, 0x63, 0x12, 0x33, 0x63, 0x22, 0x23, 0x63, 0x22, 0x23, 0x63, 0x22, 0x23, 0x63, 0x32, 0x13, 0x63, 0x32, 0x13, 0x63, 0x32, 0x13, 0x63, 0x45, 0x63, 0x45, 0x63, 0x45, 0x63, 0x54, 0x63, 0x54, 0xF0, 0x75,  // Символ 78 <N>
+    0xF5, 0x86, 0xB8, 0x93, 0x43, 0x73, 0x63, 0x63, 0x63, 0x62, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x82, 0x63, 0x63, 0x63, 0x63, 0x73, 0x43, 0x98, 0xB5, 0xF0, 0x78,  // Символ 79 <O>
+    0xF9, 0x81, 0x9B, 0x73, 0x54, 0x63, 0x64, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x63, 0x63, 0x54, 0x6B, 0x79, 0x93, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x7E,  // Символ 80 <P>
+    0xF6, 0x86, 0xA9, 0x84, 0x34, 0x64, 0x63, 0x53, 0x73, 0x53, 0x83, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x83, 0x53, 0x73, 0x53, 0x64, 0x64, 0x34, 0x89, 0xA6, 0xE3, 0xF4, 0x00, 0xF3, 0x00, 0x41, 0xA9, 0xB6, 0xF0, 0x18,  // Символ 81 <Q>
+    0xF8, 0x81, 0xAA, 0x83, 0x44, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x43, 0x89, 0x97, 0xB3, 0x32, 0xA3, 0x33, 0x93, 0x42, 0x93, 0x43, 0x83, 0x52, 0x83, 0x53, 0x73, 0x53, 0x73, 0x62, 0x73, 0x63, 0xF0, 0x75,  // Символ 82 <R>
+    0xF7, 0x85, 0x9A, 0x74, 0x61, 0x63, 0xF3, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0xF6, 0x00, 0xD7, 0xE6, 0xE4, 0xF4, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x51, 0x74, 0x6B, 0x97, 0xF0, 0x78,  // Символ 83 <S>
+    0xFD, 0x81, 0x5D, 0xA3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x79,  // Символ 84 <T>
+    0xF3, 0x81, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x54, 0x53, 0x73, 0x44, 0x89, 0xA6, 0xF0, 0x78,  // Символ 85 <U>
+    0xF3, 0x81, 0xA2, 0x33, 0x93, 0x33, 0x93, 0x42, 0x92, 0x53, 0x73, 0x53, 0x73, 0x62, 0x72, 0x73, 0x53, 0x73, 0x53, 0x82, 0x52, 0x93, 0x33, 0x93, 0x33, 0xA2, 0x32, 0xB3, 0x13, 0xB3, 0x13, 0xC2, 0x12, 0xD2, 0x12, 0xD5, 0xE3, 0xF0, 0x78,  // Символ 86 <V>
+    0xF3, 0x81, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x32, 0x33, 0x43, 0x32, 0x33, 0x43, 0x24, 0x23, 0x43, 0x24, 0x23, 0x52, 0x24, 0x22, 0x62, 0x21, 0x22, 0x12, 0x62, 0x12, 0x22, 0x12, 0x62, 0x12, 0x22, 0x12, 0x62, 0x11, 0x44, 0x64, 0x44, 0x64, 0x44, 0x63, 0x63, 0x63, 0x63, 0xF0, 0x74,  // Символ 87 <W>
+    0xF3, 0x82, 0x83, 0x53, 0x63, 0x72, 0x62, 0x83, 0x43, 0x93, 0x23, 0xA3, 0x23, 0xB6, 0xD4, 0xE4, 0xE4, 0xD5, 0xD6, 0xB3, 0x23, 0xA3, 0x23, 0x93, 0x43, 0x73, 0x63, 0x63, 0x63, 0x53, 0x83, 0x33, 0xA3, 0xF0, 0x71,  // Символ 88 <X>
+    0xF3, 0x81, 0xB3, 0x23, 0x93, 0x34, 0x83, 0x43, 0x73, 0x63, 0x53, 0x73, 0x53, 0x83, 0x33, 0x93, 0x33, 0xA3, 0x13, 0xC5, 0xD5, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x77,  // Символ 89 <Y>
+    0xFD, 0x81, 0x5D, 0xF2, 0x00, 0xF3, 0x00, 0xE3, 0xF2, 0x00, 0xF3, 0x00, 0xE3, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xE3, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF2, 0x00, 0xFC, 0x00, 0x6C, 0xF0, 0x75,  // Символ 90 <Z>
+    0xF8, 0x5D, 0xA8, 0xA3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF8, 0x00, 0xA8, 0xF0, 0x0D,  // Символ 91 <[>
+    0xF3, 0x6F, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x02, 0xF2, 0x01, 0xF3, 0x01, 0xF2, 0x01, 0xF3, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x02, 0xF2, 0x01, 0xF3, 0x01, 0xF2, 0x01, 0xF3, 0x01, 0xF2, 0x01, 0xF3, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF3, 0x01, 0xF2, 0x01, 0xF3, 0x01, 0xF2, 0x01, 0xF0, 0x3F,  // Символ 92 <\>
+    0xF8, 0x5D, 0xA8, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xA8, 0xA8, 0xF0, 0x0D,  // Символ 93 <]>
+    0xF3, 0x85, 0xF4, 0x00, 0xD2, 0x12, 0xD2, 0x13, 0xB2, 0x33, 0x93, 0x42, 0x93, 0x43, 0x73, 0x63, 0x63, 0x63, 0xF0, 0xFF, 0xF0, 0x1B,  // Символ 94 <^>
+    0xF0, 0xFF, 0xF0, 0xFF, 0xFF, 0x03, 0x01, 0x2F, 0x01, 0xF0, 0x05,  // Символ 95 <_>
+    0xF4, 0x81, 0xF4, 0x00, 0xF3, 0x01, 0xF0, 0xFF, 0xF0, 0x8D,  // Символ 96 <`>
+    0xF6, 0xDE, 0xAA, 0x81, 0x64, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x99, 0x7B, 0x64, 0x53, 0x63, 0x63, 0x63, 0x63, 0x64, 0x35, 0x7B, 0x85, 0x23, 0xF0, 0x75,  // Символ 97 <a>
+    0xF3, 0x6F, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x25, 0x83, 0x17, 0x75, 0x43, 0x64, 0x54, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x63, 0x63, 0x54, 0x6B, 0x97, 0xF0, 0x78,  // Символ 98 <b>
+    0xF6, 0xDF, 0xA9, 0x84, 0x51, 0x83, 0xE4, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x01, 0xF4, 0x00, 0x51, 0x99, 0xB6, 0xF0, 0x77,  // Символ 99 <c>
+    0xF3, 0x79, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x99, 0x7B, 0x64, 0x53, 0x63, 0x63, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x64, 0x54, 0x54, 0x63, 0x36, 0x77, 0x13, 0x85, 0x23, 0xF0, 0x74,  // Символ 100 <d>
+    0xF5, 0xDF, 0xB9, 0x84, 0x34, 0x73, 0x53, 0x63, 0x73, 0x53, 0x73, 0x5D, 0x5D, 0x53, 0xF3, 0x00, 0xF3, 0x01, 0xF4, 0x00, 0x61, 0x8A, 0xA7, 0xF0, 0x76,  // Символ 101 <e>
+    0xF6, 0x77, 0xA8, 0xA3, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xAD, 0x5D, 0xA3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x79,  // Символ 102 <f>
+    0xFA, 0xDF, 0x6C, 0x63, 0x43, 0x73, 0x63, 0x63, 0x63, 0x63, 0x63, 0x73, 0x43, 0x8A, 0x88, 0x93, 0xF3, 0x00, 0xF4, 0x00, 0xFA, 0x00, 0x7C, 0x63, 0x64, 0x43, 0x83, 0x43, 0x83, 0x44, 0x63, 0x6B, 0x97, 0xF0, 0x0B,  // Символ 103 <g>
+    0xF3, 0x6F, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x25, 0x83, 0x17, 0x75, 0x34, 0x64, 0x53, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xF0, 0x75,  // Символ 104 <h>
+    0xF2, 0x74, 0xF4, 0x00, 0xE4, 0xF2, 0x00, 0xF8, 0x20, 0xA8, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xAB, 0x7B, 0xF0, 0x76,  // Символ 105 <i>
+    0xF2, 0x76, 0xF4, 0x00, 0xE4, 0xF2, 0x00, 0xF9, 0x1F, 0x99, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE4, 0x81, 0x53, 0x98, 0xB6, 0xF0, 0x0E,  // Символ 106 <j>
+    0xF3, 0x6F, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x63, 0x63, 0x53, 0x73, 0x43, 0x83, 0x33, 0x93, 0x23, 0xA3, 0x13, 0xB6, 0xC3, 0x13, 0xB3, 0x23, 0xA3, 0x23, 0xA3, 0x33, 0x93, 0x43, 0x83, 0x53, 0x73, 0x63, 0xF0, 0x75,  // Символ 107 <k>
+    0xF8, 0x6F, 0xA8, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xAB, 0x7B, 0xF0, 0x76,  // Символ 108 <l>
+    0xF3, 0xDB, 0x14, 0x24, 0x48, 0x16, 0x34, 0x24, 0x23, 0x34, 0x24, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xF0, 0x72,  // Символ 109 <m>
+    0xF3, 0xDB, 0x25, 0x83, 0x17, 0x75, 0x34, 0x64, 0x53, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xF0, 0x75,  // Символ 110 <n>
+    0xF6, 0xDF, 0xAA, 0x74, 0x44, 0x63, 0x63, 0x53, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x53, 0x63, 0x64, 0x44, 0x7A, 0xA6, 0xF0, 0x77,  // Символ 111 <o>
+    0xF3, 0xDB, 0x25, 0x83, 0x17, 0x75, 0x43, 0x64, 0x54, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x63, 0x63, 0x54, 0x6B, 0x79, 0x93, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x12,  // Символ 112 <p>
+    0xF9, 0xE1, 0x7B, 0x64, 0x53, 0x63, 0x63, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x64, 0x54, 0x54, 0x63, 0x36, 0x77, 0x13, 0x85, 0x23, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x06,  // Символ 113 <q>
+    0xF3, 0xDB, 0x25, 0x83, 0x17, 0x75, 0x34, 0x64, 0x53, 0x63, 0x63, 0x63, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x7E,  // Символ 114 <r>
+    0xF6, 0xDE, 0xA9, 0x84, 0x51, 0x83, 0xF3, 0x00, 0xF5, 0x00, 0xE7, 0xD7, 0xE5, 0xF3, 0x00, 0xF3, 0x00, 0x71, 0x64, 0x7A, 0x97, 0xF0, 0x79,  // Символ 115 <s>
+    0xF2, 0x86, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xBD, 0x5D, 0x93, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF8, 0x00, 0xB7, 0xF0, 0x74,  // Символ 116 <t>
+    0xF3, 0xDB, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x54, 0x64, 0x35, 0x77, 0x13, 0x85, 0x23, 0xF0, 0x75,  // Символ 117 <u>
+    0xF2, 0xDB, 0x92, 0x53, 0x73, 0x53, 0x72, 0x73, 0x62, 0x73, 0x53, 0x82, 0x52, 0x93, 0x33, 0x93, 0x32, 0xB2, 0x32, 0xB3, 0x13, 0xC2, 0x12, 0xD2, 0x12, 0xD4, 0xF3, 0x00, 0xF0, 0x79,  // Символ 118 <v>
+    0xF2, 0xDB, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0x42, 0x42, 0x43, 0x23, 0x33, 0x43, 0x23, 0x33, 0x52, 0x21, 0x12, 0x22, 0x62, 0x21, 0x12, 0x22, 0x62, 0x12, 0x12, 0x22, 0x62, 0x12, 0x22, 0x12, 0x62, 0x11, 0x32, 0x12, 0x62, 0x11, 0x35, 0x64, 0x43, 0x83, 0x43, 0xF0, 0x75,  // Символ 119 <w>
+    0xF4, 0xDB, 0x73, 0x53, 0x63, 0x73, 0x43, 0x93, 0x23, 0xA3, 0x23, 0xB6, 0xD4, 0xE4, 0xD6, 0xC2, 0x23, 0xA3, 0x23, 0x93, 0x43, 0x73, 0x63, 0x54, 0x64, 0xF0, 0x73,  // Символ 120 <x>
+    0xF2, 0xDC, 0x92, 0x53, 0x73, 0x53, 0x72, 0x73, 0x53, 0x73, 0x53, 0x82, 0x52, 0x93, 0x33, 0x93, 0x32, 0xB2, 0x32, 0xB3, 0x13, 0xC2, 0x12, 0xD5, 0xD4, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xB6, 0xC4, 0xF0, 0x11,  // Символ 121 <y>
+    0xFB, 0xDB, 0x7B, 0xF2, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xE3, 0xF2, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xE3, 0xF2, 0x00, 0xF2, 0x00, 0xFB, 0x00, 0x7B, 0xF0, 0x76,  // Символ 122 <z>
+    0xF4, 0x63, 0xD5, 0xD3, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xC5, 0xD6, 0xF3, 0x00, 0xF3, 0x01, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF5, 0x00, 0xE4, 0xF0, 0x0B,  // Символ 123 <{>
+    0xF3, 0x39, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x12,  // Символ 124 <|>
+    0xF4, 0x5D, 0xE5, 0xF3, 0x00, 0xF3, 0x01, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x01, 0xF6, 0x00, 0xD5, 0xC3, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE4, 0xC5, 0xD4, 0xF0, 0x11,  // Символ 125 <}>
+    0xF0, 0xFF, 0xF4, 0x05, 0xD6, 0x53, 0x34, 0x22, 0x43, 0x33, 0x42, 0x24, 0x33, 0x56, 0xD4, 0xF0, 0xCE,  // Символ 126 <~>
+    0xF7, 0x4B, 0xB7, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB1, 0x42, 0xB7, 0xB7, 0xF0, 0x7A,  // Символ 127 <>
+    0xF0, 0xFF, 0xFF, 0x03, 0x01, 0x2F, 0x01, 0xF0, 0xFF, 0xF0, 0x05,  // Символ 128 <Ђ>
+    0x02, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF0, 0x01,  // Символ 129 <Ѓ>
+    0xF0, 0xFF, 0xF9, 0x03, 0x99, 0x92, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF0, 0x01,  // Символ 130 <‚>
+    0xF0, 0xFF, 0xF9, 0x03, 0x99, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x90,  // Символ 131 <ѓ>
+    0x02, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF9, 0x01, 0x99, 0xF0, 0xFF, 0xF0, 0x0C,  // Символ 132 <„>
+    0x72, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x99, 0x99, 0xF0, 0xFF, 0xF0, 0x0C,  // Символ 133 <…>
+    0x02, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF9, 0x01, 0x99, 0x92, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF0, 0x01,  // Символ 134 <†>
+    0x72, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x99, 0x99, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x90,  // Символ 135 <‡>
+    0xF0, 0xFF, 0xFF, 0x03, 0x01, 0x2F, 0x01, 0x92, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x90,  // Символ 136 <€>
+    0x72, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x9F, 0x01, 0x2F, 0x01, 0xF0, 0xFF, 0xF0, 0x05,  // Символ 137 <‰>
+    0x72, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x9F, 0x01, 0x2F, 0x01, 0x92, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x90,  // Символ 138 <Љ>
+    0x0F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0xF0, 0xFF, 0xF0, 0x17,  // Символ 139 <‹>
+    0xF0, 0xFF, 0xFF, 0x15, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x20,  // Символ 140 <Њ>
+    0x0F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x20,  // Символ 141 <Ќ>
+    0x08, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA0,  // Символ 142 <Ћ>
+    0x08, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA0,  // Символ 143 <Џ>
+    0xF1, 0x03, 0x42, 0x41, 0x61, 0x42, 0x41, 0xF1, 0x0C, 0x41, 0x42, 0x61, 0x41, 0x42, 0xF1, 0x06, 0x42, 0x41, 0x61, 0x42, 0x41, 0xF1, 0x0C, 0x41, 0x42, 0x61, 0x41, 0x42, 0xF1, 0x06, 0x42, 0x41, 0x61, 0x42, 0x41, 0xF1, 0x0C, 0x41, 0x42, 0x61, 0x41, 0x42, 0xF1, 0x06, 0x42, 0x41, 0x61, 0x42, 0x41, 0xF1, 0x0C, 0x41, 0x42, 0x61, 0x41, 0x42, 0xF1, 0x06, 0x42, 0x41, 0x61, 0x42, 0x41, 0xF1, 0x0C, 0x41, 0x42, 0x61, 0x41, 0x42, 0xF1, 0x06, 0x42, 0x41, 0x61, 0x42, 0x41, 0xF0, 0x09,  // Символ 144 <ђ>
+    0xF1, 0x03, 0x21, 0x12, 0x11, 0x21, 0x12, 0x31, 0x21, 0x12, 0x11, 0x21, 0x12, 0xF2, 0x07, 0x11, 0x21, 0x12, 0x11, 0x21, 0x32, 0x11, 0x21, 0x12, 0x11, 0x21, 0xF1, 0x05, 0x21, 0x12, 0x11, 0x21, 0x12, 0x31, 0x21, 0x12, 0x11, 0x21, 0x12, 0xF2, 0x07, 0x11, 0x21, 0x12, 0x11, 0x21, 0x32, 0x11, 0x21, 0x12, 0x11, 0x21, 0xF1, 0x05, 0x21, 0x12, 0x11, 0x21, 0x12, 0x31, 0x21, 0x12, 0x11, 0x21, 0x12, 0xF2, 0x07, 0x11, 0x21, 0x12, 0x11, 0x21, 0x32, 0x11, 0x21, 0x12, 0x11, 0x21, 0xF1, 0x05, 0x21, 0x12, 0x11, 0x21, 0x12, 0x31, 0x21, 0x12, 0x11, 0x21, 0x12, 0xF2, 0x07, 0x11, 0x21, 0x12, 0x11, 0x21, 0x32, 0x11, 0x21, 0x12, 0x11, 0x21, 0xF1, 0x05, 0x21, 0x12, 0x11, 0x21, 0x12, 0x31, 0x21, 0x12, 0x11, 0x21, 0x12, 0xF2, 0x07, 0x11, 0x21, 0x12, 0x11, 0x21, 0x32, 0x11, 0x21, 0x12, 0x11, 0x21, 0xF1, 0x05, 0x21, 0x12, 0x11, 0x21, 0x12, 0x31, 0x21, 0x12, 0x11, 0x21, 0x12, 0xF0, 0x06,  // Символ 145 <‘>
+    0x01, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x3F, 0x01, 0x2F, 0x01, 0x21, 0x21, 0x12, 0x11, 0x21, 0x12, 0x30,  // Символ 146 <’>
+    0x35, 0xB7, 0xB3, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x00,  // Символ 147 <“>
+    0xFF, 0xB7, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0x2F, 0x01, 0xF0, 0x71,  // Символ 148 <”>
+    0xF0, 0xFF, 0xF3, 0x04, 0xE5, 0xD5, 0xD5, 0xE3, 0xF0, 0xE9,  // Символ 149 <•>
+    0xF3, 0x7B, 0xF2, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0x71, 0x73, 0x63, 0x63, 0x63, 0x62, 0x83, 0x43, 0x83, 0x43, 0x93, 0x32, 0xA3, 0x23, 0xB3, 0x13, 0xB3, 0x12, 0xD5, 0xD5, 0xE3, 0xF0, 0x79,  // Символ 150 <–>
+    0xF3, 0xEF, 0xD7, 0x32, 0x62, 0x37, 0xD3, 0xF3, 0x1F, 0xD7, 0x32, 0x62, 0x37, 0xD3, 0xF0, 0xAD,  // Символ 151 <—>
+    0xF1, 0x9C, 0xF4, 0x00, 0xD4, 0xC4, 0xD3, 0xD4, 0xD3, 0xF4, 0x01, 0xF3, 0x01, 0xF4, 0x01, 0xF4, 0x01, 0xF4, 0x00, 0xF1, 0x01, 0xFC, 0x2F, 0x6C, 0xF0, 0x75,  // Символ 152 <>
+    0xF1, 0x95, 0xF4, 0x01, 0xF4, 0x00, 0xF4, 0x01, 0xF3, 0x01, 0xF4, 0x01, 0xF3, 0x01, 0xD4, 0xD3, 0xD4, 0xC4, 0xD4, 0xF1, 0x00, 0xFC, 0x36, 0x6C, 0xF0, 0x75,  // Символ 153 <™>
+    0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0x39,  // Символ 154 <љ>
+    0x53, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xB7, 0xB5, 0xD0,  // Символ 155 <›>
+    0xF5, 0x72, 0xC8, 0x93, 0x33, 0x83, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x83, 0x33, 0x98, 0xC5, 0xF0, 0xFF, 0xF0, 0x1F,  // Символ 156 <њ>
+    0xF4, 0x71, 0xC7, 0xC1, 0x33, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xE4, 0xD4, 0xD4, 0xD9, 0x99, 0xF0, 0xFF, 0xF0, 0x0C,  // Символ 157 <ќ>
+    0xF0, 0xFF, 0xF3, 0x04, 0xE5, 0xD5, 0xD5, 0xE3, 0xF0, 0xE9,  // Символ 158 <ћ>
+    0xF2, 0xBD, 0xF4, 0x00, 0xE4, 0xF2, 0x00, 0xFE, 0x31, 0x4E, 0xF2, 0x31, 0xF4, 0x00, 0xE4, 0xF2, 0x00, 0xF0, 0x79,  // Символ 159 <џ>
+    0xFF, 0xED, 0x01, 0x2F, 0x01, 0xFF, 0x17, 0x01, 0x2F, 0x01, 0xF0, 0xEF,  // Символ 160 <>
+    0x02, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC0,  // Символ 161 <Ў>
+    0xF9, 0xED, 0x99, 0xF9, 0x1E, 0x99, 0x92, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF0, 0x01,  // Символ 162 <ў>
+    0xF3, 0x70, 0x33, 0x93, 0x33, 0x93, 0x33, 0xF5, 0x33, 0xB9, 0x84, 0x34, 0x73, 0x53, 0x63, 0x73, 0x53, 0x73, 0x5D, 0x5D, 0x53, 0xF3, 0x00, 0xF3, 0x01, 0xF4, 0x00, 0x61, 0x8A, 0xA7, 0xF0, 0x76,  // Символ 163 <Ј>
+    0xF0, 0xFF, 0xF2, 0x03, 0x27, 0x72, 0x27, 0x72, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC0,  // Символ 164 <¤>
+    0xFB, 0xED, 0x7B, 0x72, 0xF2, 0x01, 0xF2, 0x01, 0x27, 0x72, 0x27, 0x72, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC0,  // Символ 165 <Ґ>
+    0xF9, 0xED, 0x99, 0xF9, 0x1E, 0x99, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x90,  // Символ 166 <¦>
+    0xF0, 0xFF, 0xF7, 0x03, 0x22, 0x77, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x70,  // Символ 167 <§>
+    0xFB, 0xED, 0x7B, 0xF2, 0x01, 0xF2, 0x01, 0x77, 0x22, 0x77, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x70,  // Символ 168 <Ё>
+    0x02, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF9, 0x01, 0x99, 0xF9, 0x1E, 0x99, 0xF0, 0xF6,  // Символ 169 <©>
+    0x02, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x27, 0x72, 0x27, 0xF0, 0xFF, 0xF0, 0x0A,  // Символ 170 <Є>
+    0x02, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x27, 0x72, 0x27, 0x72, 0xF2, 0x01, 0xFB, 0x01, 0x7B, 0xF0, 0xF4,  // Символ 171 <«>
+    0x72, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x99, 0x99, 0xF9, 0x1E, 0x99, 0xF0, 0xF6,  // Символ 172 <¬>
+    0x52, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x77, 0x22, 0x77, 0x22, 0xF0, 0xFF, 0xF0, 0x0A,  // Символ 173 <>
+    0x52, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x77, 0x22, 0x77, 0x22, 0xF2, 0x01, 0xF2, 0x01, 0x7B, 0x7B, 0xF0, 0xF4,  // Символ 174 <®>
+    0x02, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF9, 0x01, 0x99, 0xF9, 0x1E, 0x99, 0x92, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF0, 0x01,  // Символ 175 <Ї>
+    0x02, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x27, 0x72, 0x27, 0x72, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC0,  // Символ 176 <°>
+    0x02, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x18, 0x72, 0x18, 0x72, 0xF2, 0x01, 0xF2, 0x01, 0x18, 0x72, 0x18, 0x72, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD2, 0x12, 0xD0,  // Символ 177 <±>
+    0x72, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x99, 0x99, 0xF9, 0x1E, 0x99, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x90,  // Символ 178 <І>
+    0xF3, 0x27, 0x33, 0x93, 0x33, 0x93, 0x33, 0xFB, 0x1E, 0x7B, 0x73, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xFB, 0x00, 0x7B, 0x73, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xFB, 0x00, 0x7B, 0xF0, 0x76,  // Символ 179 <і>
+    0x52, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x77, 0x22, 0x77, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x70,  // Символ 180 <ґ>
+    0x52, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x77, 0x22, 0x77, 0x22, 0xF2, 0x01, 0xF2, 0x01, 0x77, 0x22, 0x77, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x70,  // Символ 181 <µ>
+    0xFF, 0xED, 0x01, 0x2F, 0x01, 0xFF, 0x17, 0x01, 0x2F, 0x01, 0x92, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x90,  // Символ 182 <¶>
+    0xF0, 0xFF, 0xFF, 0x03, 0x01, 0x2F, 0x01, 0x72, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x70,  // Символ 183 <·>
+    0xFF, 0xED, 0x01, 0x2F, 0x01, 0xF7, 0x17, 0x27, 0x27, 0x27, 0x72, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x70,  // Символ 184 <ё>
+    0x72, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x9F, 0x01, 0x2F, 0x01, 0xFF, 0x17, 0x01, 0x2F, 0x01, 0xF0, 0xEF,  // Символ 185 <№>
+    0x52, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x7F, 0x01, 0x2F, 0x01, 0xF0, 0xFF, 0xF0, 0x05,  // Символ 186 <є>
+    0x52, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x77, 0x27, 0x27, 0x27, 0xFF, 0x17, 0x01, 0x2F, 0x01, 0xF0, 0xEF,  // Символ 187 <»>
+    0x72, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x9F, 0x01, 0x2F, 0x01, 0xFF, 0x17, 0x01, 0x2F, 0x01, 0x92, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0xF2, 0x01, 0x90,  // Символ 188 <ј>
+    0x52, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x77, 0x27, 0x27, 0x27, 0x72, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x70,  // Символ 189 <Ѕ>
+    0x52, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x77, 0x27, 0x27, 0x27, 0xF7, 0x17, 0x27, 0x27, 0x27, 0x72, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0xC2, 0x22, 0x70,  // Символ 190 <ѕ>
+    0xF6, 0x86, 0xAA, 0x74, 0x44, 0x63, 0x63, 0x53, 0x83, 0x43, 0x33, 0x23, 0x33, 0x35, 0x23, 0x23, 0x24, 0x43, 0x23, 0x23, 0x53, 0x23, 0x23, 0x53, 0x23, 0x23, 0x53, 0x23, 0x23, 0x53, 0x23, 0x35, 0x23, 0x33, 0x33, 0x23, 0x43, 0x83, 0x53, 0x63, 0x64, 0x44, 0x7A, 0xA6, 0xF0, 0x76,  // Символ 191 <ї>
+    0xF3, 0xDB, 0x54, 0x63, 0x46, 0x53, 0x42, 0x23, 0x43, 0x33, 0x23, 0x43, 0x33, 0x23, 0x43, 0x33, 0x23, 0x49, 0x23, 0x49, 0x23, 0x43, 0x33, 0x23, 0x43, 0x33, 0x23, 0x43, 0x33, 0x23, 0x43, 0x33, 0x22, 0x53, 0x46, 0x53, 0x54, 0xF0, 0x75,  // Символ 192 <А>
+    0xF6, 0xDE, 0xAA, 0x81, 0x64, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x99, 0x7B, 0x64, 0x53, 0x63, 0x63, 0x63, 0x63, 0x64, 0x35, 0x7B, 0x85, 0x23, 0xF0, 0x75,  // Символ 193 <Б>
+    0xF6, 0x74, 0xA8, 0x94, 0xE3, 0xE3, 0xF2, 0x00, 0xF3, 0x00, 0x25, 0x83, 0x17, 0x75, 0x34, 0x64, 0x53, 0x63, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x62, 0x73, 0x63, 0x53, 0x74, 0x34, 0x89, 0xB5, 0xF0, 0x78,  // Символ 194 <В>
+    0xF3, 0xDB, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x7D, 0x5D, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x2C,  // Символ 195 <Г>
+    0xF9, 0xE0, 0x99, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x84, 0x33, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x74, 0x43, 0x73, 0x53, 0x4F, 0x01, 0x2F, 0x01, 0x24, 0x93, 0x24, 0x93, 0x24, 0x93, 0x24, 0x93, 0xF0, 0x29,  // Символ 196 <Д>
+    0xF5, 0xDF, 0xB9, 0x84, 0x34, 0x73, 0x53, 0x63, 0x73, 0x53, 0x73, 0x5D, 0x5D, 0x53, 0xF3, 0x00, 0xF3, 0x01, 0xF4, 0x00, 0x61, 0x8A, 0xA7, 0xF0, 0x76,  // Символ 197 <Е>
+    0xF3, 0x75, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xD8, 0x8B, 0x64, 0x13, 0x14, 0x53, 0x23, 0x24, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 0x23, 0x23, 0x54, 0x13, 0x14, 0x6B, 0x88, 0xD3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x0C,  // Символ 198 <Ж>
+    0xFB, 0xDB, 0x7B, 0x73, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x7E,  // Символ 199 <З>
+    0xF4, 0xDB, 0x73, 0x53, 0x63, 0x73, 0x43, 0x93, 0x23, 0xA3, 0x23, 0xB6, 0xD4, 0xE4, 0xD6, 0xC2, 0x23, 0xA3, 0x23, 0x93, 0x43, 0x73, 0x63, 0x54, 0x64, 0xF0, 0x73,  // Символ 200 <И>
+    0xF3, 0xDB, 0x63, 0x63, 0x54, 0x63, 0x54, 0x63, 0x45, 0x63, 0x36, 0x63, 0x32, 0x13, 0x63, 0x23, 0x13, 0x63, 0x13, 0x23, 0x63, 0x12, 0x33, 0x66, 0x33, 0x65, 0x43, 0x64, 0x53, 0x64, 0x53, 0x63, 0x63, 0xF0, 0x75,  // Символ 201 <Й>
+    0xF3, 0x70, 0x43, 0x84, 0x24, 0x98, 0xB6, 0xF3, 0x1E, 0x63, 0x63, 0x54, 0x63, 0x54, 0x63, 0x45, 0x63, 0x36, 0x63, 0x32, 0x13, 0x63, 0x23, 0x13, 0x63, 0x13, 0x23, 0x63, 0x12, 0x33, 0x66, 0x33, 0x65, 0x43, 0x64, 0x53, 0x64, 0x53, 0x63, 0x63, 0xF0, 0x75,  // Символ 202 <К>
+    0xF3, 0xDB, 0x54, 0x63, 0x44, 0x73, 0x34, 0x83, 0x33, 0x93, 0x23, 0xA3, 0x14, 0xA7, 0xB3, 0x14, 0xA3, 0x23, 0xA3, 0x24, 0x93, 0x34, 0x83, 0x44, 0x73, 0x53, 0x73, 0x63, 0xF0, 0x75,  // Символ 203 <Л>
+    0xF9, 0xE0, 0x99, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x73, 0x53, 0x64, 0x53, 0x45, 0x63, 0x44, 0x73, 0xF0, 0x73,  // Символ 204 <М>
+    0xF3, 0xDC, 0x54, 0x54, 0x54, 0x52, 0x12, 0x32, 0x12, 0x52, 0x12, 0x32, 0x12, 0x52, 0x12, 0x32, 0x12, 0x52, 0x22, 0x12, 0x22, 0x52, 0x22, 0x12, 0x22, 0x52, 0x22, 0x12, 0x22, 0x52, 0x33, 0x32, 0x52, 0x33, 0x32, 0x52, 0x33, 0x32, 0x52, 0x92, 0x52, 0x92, 0x52, 0x92, 0xF0, 0x74,  // Символ 205 <Н>
+    0xF3, 0xDB, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6C, 0x6C, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xF0, 0x75,  // Символ 206 <О>
+    0xF6, 0xDF, 0xAA, 0x74, 0x44, 0x63, 0x63, 0x53, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x53, 0x63, 0x64, 0x44, 0x7A, 0xA6, 0xF0, 0x77,  // Символ 207 <П>
+    0xFC, 0xDB, 0x6C, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xF0, 0x75,  // Символ 208 <Р>
+    0xF9, 0xDF, 0x7B, 0x64, 0x53, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x73, 0x53, 0x7B, 0x8A, 0x73, 0x53, 0x72, 0x63, 0x63, 0x63, 0x62, 0x73, 0x53, 0x73, 0xF0, 0x74,  // Символ 209 <С>
+    0xF3, 0xDB, 0x25, 0x83, 0x17, 0x75, 0x43, 0x64, 0x54, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x63, 0x63, 0x54, 0x6B, 0x79, 0x93, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x12,  // Символ 210 <Т>
+    0xF6, 0xDF, 0xA9, 0x84, 0x51, 0x83, 0xE4, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x01, 0xF4, 0x00, 0x51, 0x99, 0xB6, 0xF0, 0x77,  // Символ 211 <У>
+    0xFD, 0xDB, 0x5D, 0xA3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x79,  // Символ 212 <Ф>
+    0xF2, 0xDC, 0x92, 0x53, 0x73, 0x53, 0x72, 0x73, 0x53, 0x73, 0x53, 0x82, 0x52, 0x93, 0x33, 0x93, 0x32, 0xB2, 0x32, 0xB3, 0x13, 0xC2, 0x12, 0xD5, 0xD4, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xB6, 0xC4, 0xF0, 0x11,  // Символ 213 <Х>
+    0xF3, 0xDB, 0x43, 0x43, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 0x23, 0x23, 0x63, 0x13, 0x13, 0x73, 0x13, 0x13, 0x89, 0x99, 0x83, 0x13, 0x13, 0x63, 0x23, 0x23, 0x53, 0x23, 0x23, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x43, 0x43, 0xF0, 0x70,  // Символ 214 <Ц>
+    0xFA, 0xDB, 0x8B, 0x73, 0x54, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x7A, 0x8B, 0x73, 0x64, 0x53, 0x73, 0x53, 0x73, 0x53, 0x64, 0x5C, 0x6A, 0xF0, 0x77,  // Символ 215 <Ч>
+    0xF3, 0xDB, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF9, 0x00, 0x9B, 0x73, 0x54, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x54, 0x6B, 0x79, 0xF0, 0x78,  // Символ 216 <Ш>
+    0xF3, 0xDB, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x38, 0x43, 0x39, 0x33, 0x33, 0x34, 0x23, 0x33, 0x43, 0x23, 0x33, 0x43, 0x23, 0x33, 0x43, 0x23, 0x33, 0x34, 0x23, 0x39, 0x33, 0x37, 0x53, 0xF0, 0x72,  // Символ 217 <Щ>
+    0xF7, 0xDD, 0x9A, 0x81, 0x64, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xA7, 0xB9, 0xF4, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0x62, 0x64, 0x6B, 0x97, 0xF0, 0x78,  // Символ 218 <Ъ>
+    0xF3, 0xDB, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x3F, 0xF0, 0x72,  // Символ 219 <Ы>
+    0xF7, 0xDC, 0xAA, 0x81, 0x64, 0xF3, 0x00, 0xF3, 0x01, 0xF3, 0x00, 0x7B, 0x7B, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0x71, 0x64, 0x7A, 0x97, 0xF0, 0x79,  // Символ 220 <Ь>
+    0xF3, 0xDB, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x01, 0x2F, 0x01, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x29,  // Символ 221 <Э>
+    0xF3, 0xDB, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x73, 0x53, 0x7B, 0x99, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x75,  // Символ 222 <Ю>
+    0xF6, 0xDB, 0xC6, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF9, 0x00, 0x9B, 0x73, 0x54, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x7B, 0x79, 0xF0, 0x75,  // Символ 223 <Я>
+    0xF3, 0x81, 0x64, 0x53, 0x47, 0x43, 0x43, 0x13, 0x43, 0x42, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x39, 0x33, 0x39, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x42, 0x32, 0x43, 0x43, 0x13, 0x43, 0x46, 0x53, 0x54, 0xF0, 0x75,  // Символ 224 <а>
+    0xF3, 0x87, 0xE5, 0xD2, 0x12, 0xD2, 0x12, 0xC3, 0x13, 0xB2, 0x32, 0xB2, 0x32, 0xA3, 0x33, 0x92, 0x52, 0x92, 0x52, 0x83, 0x53, 0x72, 0x63, 0x72, 0x72, 0x6D, 0x5D, 0x52, 0x92, 0x43, 0x93, 0x33, 0x93, 0x32, 0xB2, 0xF0, 0x72,  // Символ 225 <б>
+    0xFC, 0x81, 0x6C, 0x63, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF9, 0x00, 0x9B, 0x73, 0x54, 0x63, 0x64, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x64, 0x53, 0x54, 0x6B, 0x79, 0xF0, 0x78,  // Символ 226 <в>
+    0xF3, 0x81, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6E, 0x4E, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x2B,  // Символ 227 <г>
+    0xFA, 0x85, 0x8A, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x74, 0x43, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x64, 0x53, 0x54, 0x63, 0x4F, 0x01, 0x2F, 0x01, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0x23, 0xA3, 0xF0, 0x29,  // Символ 228 <д>
+    0xFB, 0x81, 0x7B, 0x73, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xFB, 0x00, 0x7B, 0x73, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xFB, 0x00, 0x7B, 0xF0, 0x76,  // Символ 229 <е>
+    0xF3, 0x87, 0xF3, 0x00, 0xD7, 0x9B, 0x64, 0x13, 0x14, 0x53, 0x23, 0x23, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 0x23, 0x23, 0x54, 0x13, 0x14, 0x6B, 0x97, 0xD3, 0xF3, 0x00, 0xF0, 0x78,  // Символ 230 <ж>
+    0xFB, 0x81, 0x7B, 0x73, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x7E,  // Символ 231 <з>
+    0xF3, 0x82, 0x83, 0x53, 0x63, 0x72, 0x62, 0x83, 0x43, 0x93, 0x23, 0xA3, 0x23, 0xB6, 0xD4, 0xE4, 0xE4, 0xD5, 0xD6, 0xB3, 0x23, 0xA3, 0x23, 0x93, 0x43, 0x73, 0x63, 0x63, 0x63, 0x53, 0x83, 0x33, 0xA3, 0xF0, 0x71,  // Символ 232 <и>
+    0xF3, 0x81, 0x73, 0x53, 0x64, 0x53, 0x64, 0x53, 0x55, 0x53, 0x55, 0x53, 0x46, 0x53, 0x42, 0x13, 0x53, 0x33, 0x13, 0x53, 0x32, 0x23, 0x53, 0x23, 0x23, 0x53, 0x22, 0x33, 0x53, 0x13, 0x33, 0x53, 0x12, 0x43, 0x56, 0x43, 0x55, 0x53, 0x55, 0x53, 0x54, 0x63, 0x54, 0x63, 0x53, 0x73, 0xF0, 0x74,  // Символ 233 <й>
+    0xF3, 0x28, 0x43, 0x83, 0x43, 0x98, 0xB6, 0xF3, 0x0C, 0x73, 0x53, 0x64, 0x53, 0x64, 0x53, 0x55, 0x53, 0x55, 0x53, 0x46, 0x53, 0x42, 0x13, 0x53, 0x33, 0x13, 0x53, 0x32, 0x23, 0x53, 0x23, 0x23, 0x53, 0x22, 0x33, 0x53, 0x13, 0x33, 0x53, 0x12, 0x43, 0x56, 0x43, 0x55, 0x53, 0x55, 0x53, 0x54, 0x63, 0x54, 0x63, 0x53, 0x73, 0xF0, 0x74,  // Символ 234 <к>
+    0xF3, 0x81, 0x73, 0x53, 0x63, 0x63, 0x53, 0x73, 0x43, 0x83, 0x42, 0x93, 0x33, 0x93, 0x23, 0xA3, 0x13, 0xB3, 0x12, 0xC6, 0xC3, 0x12, 0xC3, 0x13, 0xB3, 0x23, 0xA3, 0x33, 0x93, 0x43, 0x83, 0x43, 0x83, 0x53, 0x73, 0x63, 0x63, 0x73, 0xF0, 0x74,  // Символ 235 <л>
+    0xF9, 0x86, 0x99, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x93, 0x33, 0x84, 0x33, 0x84, 0x33, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x74, 0x43, 0x73, 0x53, 0x73, 0x53, 0x63, 0x63, 0x45, 0x63, 0x43, 0x83, 0xF0, 0x73,  // Символ 236 <м>
+    0xF3, 0x82, 0x64, 0x53, 0x64, 0x53, 0x64, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x42, 0x12, 0x41, 0x22, 0x42, 0x22, 0x22, 0x22, 0x42, 0x22, 0x22, 0x22, 0x42, 0x22, 0x21, 0x32, 0x42, 0x34, 0x32, 0x42, 0x34, 0x32, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0x42, 0xA2, 0xF0, 0x73,  // Символ 237 <н>
+    0xF3, 0x81, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x6C, 0x6C, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0xF0, 0x75,  // Символ 238 <о>
+    0xF5, 0x86, 0xB8, 0x93, 0x43, 0x73, 0x63, 0x63, 0x63, 0x62, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x82, 0x63, 0x63, 0x63, 0x63, 0x73, 0x43, 0x98, 0xB5, 0xF0, 0x78,  // Символ 239 <п>
+    0xFD, 0x81, 0x5D, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0xF0, 0x74,  // Символ 240 <р>
+    0xF8, 0x86, 0x8A, 0x73, 0x53, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x64, 0x53, 0x74, 0x43, 0x8A, 0x99, 0x83, 0x43, 0x73, 0x53, 0x72, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x73, 0x53, 0x73, 0xF0, 0x74,  // Символ 241 <с>
+    0xF9, 0x81, 0x9B, 0x73, 0x54, 0x63, 0x64, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x63, 0x63, 0x54, 0x6B, 0x79, 0x93, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x7E,  // Символ 242 <т>
+    0xF7, 0x86, 0x9A, 0x74, 0x61, 0x73, 0xE3, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF3, 0x00, 0xF4, 0x00, 0xF4, 0x00, 0x61, 0x8A, 0xA7, 0xF0, 0x75,  // Символ 243 <у>
+    0xFD, 0x81, 0x5D, 0xA3, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x79,  // Символ 244 <ф>
+    0xF3, 0x81, 0x92, 0x43, 0x83, 0x53, 0x72, 0x63, 0x63, 0x73, 0x53, 0x73, 0x52, 0x93, 0x33, 0x93, 0x32, 0xB3, 0x13, 0xB6, 0xD5, 0xD5, 0xE3, 0xF3, 0x00, 0xF2, 0x00, 0xF3, 0x00, 0xE3, 0xC6, 0xC4, 0xF0, 0x7C,  // Символ 245 <х>
+    0xF3, 0x81, 0x43, 0x43, 0x23, 0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 0x23, 0x23, 0x53, 0x23, 0x23, 0x53, 0x23, 0x23, 0x63, 0x13, 0x13, 0x73, 0x13, 0x13, 0x89, 0x99, 0x83, 0x13, 0x13, 0x73, 0x13, 0x13, 0x73, 0x13, 0x13, 0x63, 0x23, 0x23, 0x53, 0x23, 0x23, 0x43, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x43, 0x43, 0xF0, 0x70,  // Символ 246 <ц>
+    0xF8, 0x81, 0xAA, 0x83, 0x44, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x43, 0x89, 0x9A, 0x83, 0x44, 0x73, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x7A, 0x88, 0xF0, 0x79,  // Символ 247 <ч>
+    0xF3, 0x81, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF9, 0x00, 0x9B, 0x73, 0x54, 0x63, 0x64, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x63, 0x63, 0x54, 0x6B, 0x79, 0xF0, 0x78,  // Символ 248 <ш>
+    0xF3, 0x81, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x43, 0x83, 0x47, 0x43, 0x49, 0x23, 0x43, 0x33, 0x23, 0x43, 0x43, 0x13, 0x43, 0x43, 0x13, 0x43, 0x43, 0x13, 0x43, 0x43, 0x13, 0x43, 0x43, 0x13, 0x43, 0x43, 0x13, 0x43, 0x33, 0x23, 0x48, 0x33, 0x47, 0x43, 0xF0, 0x73,  // Символ 249 <щ>
+    0xF7, 0x83, 0xAA, 0x81, 0x64, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xD4, 0x88, 0xAA, 0xF4, 0x00, 0xF4, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0x61, 0x74, 0x6B, 0x88, 0xF0, 0x78,  // Символ 250 <ъ>
+    0xF3, 0x81, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x3F, 0xF0, 0x72,  // Символ 251 <ы>
+    0xF7, 0x82, 0xAA, 0x81, 0x64, 0xF4, 0x00, 0xF3, 0x00, 0xF3, 0x01, 0xF3, 0x00, 0xF3, 0x00, 0x6C, 0x6C, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xE3, 0xF3, 0x00, 0xE4, 0x61, 0x64, 0x7A, 0x97, 0xF0, 0x79,  // Символ 252 <ь>
+    0xF3, 0x81, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x01, 0x2F, 0x01, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x29,  // Символ 253 <э>
+    0xF3, 0x81, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x53, 0x73, 0x54, 0x63, 0x63, 0x63, 0x7B, 0x86, 0x13, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF0, 0x74,  // Символ 254 <ю>
+    0xF6, 0x81, 0xC6, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF3, 0x00, 0xF8, 0x00, 0xAA, 0x83, 0x44, 0x73, 0x54, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x63, 0x53, 0x73, 0x44, 0x7A, 0x88, 0xF0, 0x76   // Символ 255 <я>
+};
+
+// смещения матриц символов 32..255
+const uint16_t font_consolas_22_rleidx[224] =
+{
+        0,     6,    43,    62,    99,   143,   191,   233,   251,   301,   353,   379,   406,   420,   427,   437,
+      485,   527,   564,   595,   627,   662,   695,   728,   764,   799,   832,   848,   867,   895,   905,   933,
+      965,  1035,  1072,  1107,  1142,  1179,  1214,  1250,  1285,  1324,  1360,  1397,  1437,  1476,  1533,  1583,
+     1620,  1656,  1701,  1738,  1771,  1809,  1848,  1887,  1940,  1975,  2013,  2048,  2101,  2149,  2202,  2224,
+     2235,  2245,  2271,  2312,  2337,  2377,  2402,  2438,  2473,  2516,  2550,  2595,  2637,  2676,  2720,  2751,
+     2778,  2818,  2859,  2889,  2912,  2948,  2979,  3009,  3054,  3081,  3120,  3146,  3195,  3255,  3304,  3321,
+     3364,  3375,  3444,  3482,  3520,  3558,  3595,  3662,  3728,  3767,  3806,  3873,  3911,  3949,  4018,  4053,
+     4088,  4167,  4312,  4429,  4495,  4530,  4540,  4579,  4595,  4621,  4647,  4653,  4718,  4739,  4758,  4768,
+     4787,  4799,  4868,  4903,  4935,  4975,  5015,  5050,  5090,  5130,  5165,  5205,  5245,  5279,  5319,  5359,
+     5421,  5490,  5559,  5620,  5662,  5731,  5800,  5838,  5878,  5917,  5955,  5995,  6034,  6098,  6167,  6233,
+     6279,  6318,  6344,  6381,  6418,  6455,  6480,  6539,  6567,  6594,  6629,  6671,  6701,  6730,  6776,  6805,
+     6832,  6861,  6888,  6928,  6953,  6981,  7020,  7061,  7086,  7113,  7149,  7173,  7214,  7238,  7289,  7318,
+     7344,  7398,  7435,  7470,  7517,  7564,  7599,  7645,  7683,  7718,  7766,  7821,  7861,  7900,  7957,  7996,
+     8033,  8072,  8109,  8145,  8180,  8218,  8252,  8308,  8343,  8380,  8429,  8462,  8518,  8551,  8617,  8657
+};
+
+// описание шрифта для print_char_font()
+const st7735_font fd_consolas_22_rle = { font_consolas_22_rle, font_consolas_22_rleidx, 0, 18, 34, 32, 224, BITS_RLE, 0 };
+
+#endif // FONT_CONSOLAS_22_RLE_H
@@ -1,371 +1,111 @@
-// SixteenSegment24x36.h
-// Font type    : Full (95 characters)
-// Font size    : 24x36 pixels
-// Memory usage : 10264 bytes
+// SixteenSegment24x36 (из SixteenSegment24x36.h), матрицы построчно, младший бит - левая точка (BITS_RB)
+// 10260 байт матриц, сгенерировано tools/fontc
 
-const unsigned char SixteenSegment24x36[10264] ={
-// 0x18,0x24,0x20,0x5F,
-// 95 строк
-// 540 / 5 = 108
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // !
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // "
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xFF,0xFC,0x70,0x18,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x18,0x0E,0x77,0xDB,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xDB,0xFE,0x70,0x18,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x18,0x0E,0x3F,0xFF,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // #
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xFF,0xF8,0x70,0x18,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x18,0x00,0x77,0xDB,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xDB,0xFE,0x00,0x18,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x18,0x0E,0x1F,0xFF,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // $
-0x00,0x00,0x00,0x0F,0xE0,0x00,0x1F,0xE0,0x00,0x3F,0xF8,0x00,0x70,0x18,0x00,0x70,0x1C,0x30,0x70,0x1C,0x70,0x70,0x1C,0x70,0x70,0x1C,0xE0,0x70,0x1C,0xE0,0x70,0x1D,0xC0,0x70,0x19,0xC0,0x70,0x1B,0x80,0x70,0x1F,0x80,0x70,0x1F,0x00,0x70,0x1E,0x00,0x77,0xD8,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xDB,0xFE,0x00,0x78,0x0E,0x00,0xFC,0x0E,0x00,0xFC,0x0E,0x01,0xDC,0x0E,0x03,0x9C,0x0E,0x03,0x9C,0x0E,0x07,0x1C,0x0E,0x07,0x1C,0x0E,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x0C,0x1C,0x0E,0x00,0x18,0x0E,0x00,0x1F,0xFC,0x00,0x07,0xF8,0x00,0x07,0xF0,0x00,0x00,0x00,  // %
-0x00,0x00,0x00,0x0F,0xE0,0x00,0x1F,0xE0,0x00,0x3F,0xF8,0x00,0x70,0x18,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x77,0xD8,0x00,0x1F,0xE0,0x00,0x1F,0xE0,0x00,0x7F,0xC0,0x00,0x70,0x02,0x00,0x70,0x03,0x00,0x70,0x03,0x80,0x70,0x03,0x80,0x70,0x01,0xC0,0x70,0x01,0xC0,0x70,0x00,0xE0,0x70,0x00,0xE0,0x70,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0x30,0x70,0x00,0x00,0x3F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // &
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // '
-0x00,0x00,0x00,0x00,0x07,0xF0,0x00,0x07,0xF8,0x00,0x07,0xF8,0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x0C,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x40,0x00,0x00,0x07,0xF8,0x00,0x07,0xF8,0x00,0x07,0xF0,0x00,0x00,0x00,  // (
-0x00,0x00,0x00,0x0F,0xE0,0x00,0x1F,0xF0,0x00,0x1F,0xE0,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x00,0xE0,0x00,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0xF0,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x1F,0xE0,0x00,0x1F,0xF0,0x00,0x0F,0xE0,0x00,0x00,0x00,0x00,  // )
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x0C,0x1C,0x30,0x0E,0x1C,0x70,0x0E,0x1C,0x70,0x07,0x1C,0xE0,0x07,0x1C,0xE0,0x03,0x9D,0xC0,0x03,0x99,0xC0,0x01,0xDB,0x80,0x00,0xFF,0x80,0x00,0xFF,0x00,0x00,0x7E,0x00,0x07,0x18,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xDB,0xF0,0x00,0x7E,0x00,0x00,0xFF,0x00,0x00,0xFF,0x80,0x01,0xDB,0x80,0x03,0x99,0xC0,0x03,0x9D,0xC0,0x07,0x1C,0xE0,0x07,0x1C,0xE0,0x0E,0x1C,0x70,0x0E,0x1C,0x70,0x0C,0x1C,0x30,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // *
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x07,0xDB,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xDB,0xF0,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // +
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ,
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xC3,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // -
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,  // .
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // /
+#ifndef FONT_SIXTEEN_SEGMENT_24X36_H
+#define FONT_SIXTEEN_SEGMENT_24X36_H
 
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xFC,0x70,0x00,0x0E,0x70,0x00,0x3E,0x70,0x00,0x7E,0x70,0x00,0x7E,0x70,0x00,0xEE,0x70,0x00,0xEE,0x70,0x01,0xCE,0x70,0x01,0xCE,0x70,0x03,0x8E,0x70,0x03,0x8E,0x70,0x03,0x0E,0x70,0x03,0x0E,0x70,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0E,0x70,0x40,0x0E,0x70,0xC0,0x0E,0x70,0xC0,0x0E,0x71,0xC0,0x0E,0x73,0x80,0x0E,0x73,0x80,0x0E,0x77,0x00,0x0E,0x77,0x00,0x0E,0x7E,0x00,0x0E,0x7E,0x00,0x0E,0x7C,0x00,0x0E,0x70,0x00,0x0E,0x3F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // 0
-0x00,0x00,0x00,0x0F,0xE0,0x00,0x1F,0xE0,0x00,0x1F,0xF8,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x1F,0xFF,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // 1
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xFC,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x07,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xF0,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x3F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // 2
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xFC,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x07,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xC3,0xFE,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x1F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // 3
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x77,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xC3,0xFE,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 4
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xF8,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x77,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xC3,0xFE,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x1F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // 5
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xF8,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x77,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xFE,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x3F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // 6
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xFC,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 7
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xFC,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x77,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xFE,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x3F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // 8
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xFC,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x77,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xC3,0xFE,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x1F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // 9
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // :
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ;
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // =
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x70,0x00,0x00,0x78,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x60,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // >
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xFC,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x03,0xEE,0x00,0x07,0xF8,0x00,0x07,0xF8,0x00,0x1B,0xF0,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ?
+#include "../lcd7735sl.h"
 
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xFF,0xFC,0x70,0x18,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x18,0x0E,0x70,0x1B,0xEE,0x00,0x07,0xF8,0x00,0x07,0xF8,0x70,0x03,0xF0,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x3F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // @
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xFC,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x77,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xFE,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x20,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // A
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xFF,0xFC,0x00,0x18,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x18,0x0E,0x07,0xDB,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xDB,0xFE,0x00,0x18,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x18,0x0E,0x1F,0xFF,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // B
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xF8,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x3F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // C
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xFF,0xFC,0x00,0x18,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x18,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x1C,0x0E,0x00,0x18,0x0E,0x1F,0xFF,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // D
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xF8,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x77,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xF0,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x3F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // E
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xF8,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x77,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xF0,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // F
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xF8,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x03,0xE0,0x00,0x07,0xF8,0x00,0x07,0xF8,0x70,0x03,0xFE,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x3F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // G
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x77,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xFE,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x20,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // H
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xFF,0xF8,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x1F,0xFF,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // I
-0x00,0x00,0x00,0x00,0x07,0xF0,0x00,0x07,0xF8,0x00,0x07,0xFC,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x3F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // J
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x30,0x70,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0xE0,0x70,0x00,0xE0,0x70,0x01,0xC0,0x70,0x01,0xC0,0x70,0x03,0x80,0x70,0x03,0x80,0x70,0x03,0x00,0x70,0x03,0x00,0x77,0xC0,0x00,0x1F,0xE0,0x00,0x1F,0xE0,0x00,0x7F,0xC0,0x00,0x70,0x02,0x00,0x70,0x03,0x00,0x70,0x03,0x80,0x70,0x03,0x80,0x70,0x01,0xC0,0x70,0x01,0xC0,0x70,0x00,0xE0,0x70,0x00,0xE0,0x70,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0x30,0x70,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // K
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x3F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // L
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x70,0x00,0x0E,0x7C,0x00,0x3E,0x7E,0x00,0x7E,0x7E,0x00,0x7E,0x77,0x00,0xEE,0x77,0x00,0xEE,0x73,0x81,0xCE,0x73,0x81,0xCE,0x71,0xC3,0x8E,0x70,0xC3,0x8E,0x70,0xC3,0x0E,0x70,0x43,0x0E,0x70,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x18,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x18,0x0E,0x20,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // M
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x70,0x00,0x0E,0x7C,0x00,0x0E,0x7E,0x00,0x0E,0x7E,0x00,0x0E,0x77,0x00,0x0E,0x77,0x00,0x0E,0x73,0x80,0x0E,0x73,0x80,0x0E,0x71,0xC0,0x0E,0x70,0xC0,0x0E,0x70,0xC0,0x0E,0x70,0x40,0x0E,0x70,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0E,0x70,0x02,0x0E,0x70,0x03,0x0E,0x70,0x03,0x8E,0x70,0x03,0x8E,0x70,0x01,0xCE,0x70,0x01,0xCE,0x70,0x00,0xEE,0x70,0x00,0xEE,0x70,0x00,0x7E,0x70,0x00,0x7E,0x70,0x00,0x3E,0x70,0x00,0x0E,0x20,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // N
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xFC,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x3F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // O
-
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xFC,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x77,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xF0,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // P
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xFC,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0E,0x70,0x02,0x0E,0x70,0x03,0x0E,0x70,0x03,0x8E,0x70,0x03,0x8E,0x70,0x01,0xCE,0x70,0x01,0xCE,0x70,0x00,0xEE,0x70,0x00,0xEE,0x70,0x00,0x7E,0x70,0x00,0x7E,0x70,0x00,0x3E,0x70,0x00,0x0E,0x3F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // Q
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xFC,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x77,0xC0,0x0E,0x1F,0xE0,0x00,0x1F,0xE0,0x00,0x7F,0xC0,0x00,0x70,0x02,0x00,0x70,0x03,0x00,0x70,0x03,0x80,0x70,0x03,0x80,0x70,0x01,0xC0,0x70,0x01,0xC0,0x70,0x00,0xE0,0x70,0x00,0xE0,0x70,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0x30,0x70,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // R
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xF8,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x77,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xC3,0xFE,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x1F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // S
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xFF,0xF8,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // T
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x3F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // U
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x30,0x70,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0xE0,0x70,0x00,0xE0,0x70,0x01,0xC0,0x70,0x01,0xC0,0x70,0x03,0x80,0x70,0x03,0x80,0x70,0x03,0x00,0x70,0x03,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x70,0x40,0x00,0x70,0xC0,0x00,0x70,0xC0,0x00,0x71,0xC0,0x00,0x73,0x80,0x00,0x73,0x80,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7C,0x00,0x00,0x70,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // V
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x18,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x18,0x0E,0x3F,0xFF,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // W
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x30,0x0E,0x00,0x70,0x0E,0x00,0x70,0x07,0x00,0xE0,0x07,0x00,0xE0,0x03,0x81,0xC0,0x03,0x81,0xC0,0x01,0xC3,0x80,0x00,0xC3,0x80,0x00,0xC3,0x00,0x00,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x00,0xC3,0x00,0x00,0xC3,0x80,0x01,0xC3,0x80,0x03,0x81,0xC0,0x03,0x81,0xC0,0x07,0x00,0xE0,0x07,0x00,0xE0,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0C,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // X
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x30,0x0E,0x00,0x70,0x0E,0x00,0x70,0x07,0x00,0xE0,0x07,0x00,0xE0,0x03,0x81,0xC0,0x03,0x81,0xC0,0x01,0xC3,0x80,0x00,0xC3,0x80,0x00,0xC3,0x00,0x00,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // Y
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // Z
-0x00,0x00,0x00,0x0F,0xE0,0x00,0x1F,0xF0,0x00,0x3F,0xE0,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x3F,0xE0,0x00,0x1F,0xF0,0x00,0x0F,0xE0,0x00,0x00,0x00,0x00,  // [
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x03,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <backslash>
-0x00,0x00,0x00,0x00,0x07,0xF0,0x00,0x07,0xF8,0x00,0x07,0xFC,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x07,0xFC,0x00,0x07,0xF8,0x00,0x07,0xF0,0x00,0x00,0x00,  // ]
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0x00,0xC3,0x00,0x01,0xC3,0x80,0x01,0xC3,0x80,0x03,0x81,0xC0,0x03,0x81,0xC0,0x07,0x00,0xE0,0x07,0x00,0xF0,0x0E,0x00,0x70,0x0E,0x00,0x30,0x0C,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ^
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // _
-
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // `
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // a
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0xFF,0x00,0x01,0xFF,0x80,0x01,0xFF,0x80,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0x01,0xFF,0x80,0x01,0xFF,0x80,0x00,0xFF,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // b
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x1F,0xFF,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // c
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x77,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xF0,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // d
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x07,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xC3,0xFE,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // e
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC0,0x00,0x1F,0xE0,0x00,0x1F,0xE0,0x00,0x7F,0xD8,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x18,0x00,0x3F,0xF8,0x00,0x1F,0xE0,0x00,0x0F,0xE0,0x00,0x00,0x00,0x00,  // f
-0x00,0x00,0x00,0x0F,0xE0,0x00,0x1F,0xE0,0x00,0x3F,0xF8,0x00,0x70,0x18,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x70,0x1C,0x00,0x77,0xD8,0x00,0x1F,0xE0,0x00,0x1F,0xE0,0x00,0x0F,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // g
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xFC,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x20,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // h
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xFC,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x1F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // i
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xDB,0xFE,0x70,0x18,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x18,0x0E,0x3F,0xFF,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // j
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xC3,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // k
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // l
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // m
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xC3,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // n
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xC3,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xC3,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // o
-
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x00,0x00,0x00,0x0C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0xC0,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x00,0x00,0x00,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // p
-0x00,0x00,0x00,0x00,0x07,0xF0,0x00,0x07,0xF8,0x00,0x1F,0xF8,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x1F,0xF8,0x00,0x1F,0xE0,0x00,0x0F,0xE0,0x00,0x00,0x00,0x00,  // q
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x07,0xDB,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xDB,0xF0,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x1F,0xFF,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // r
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x04,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x70,0x00,0x0E,0x77,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xF0,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // s
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x00,0x00,0x00,0x0C,0x00,0x30,0x0E,0x00,0x70,0x0E,0x00,0x70,0x07,0x00,0xE0,0x07,0x00,0xE0,0x03,0x81,0xC0,0x03,0x81,0xC0,0x01,0xC3,0x80,0x00,0xC3,0x80,0x00,0xC3,0x00,0x00,0x43,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x42,0x00,0x00,0xC3,0x00,0x00,0xC3,0x80,0x01,0xC3,0x80,0x03,0x81,0xC0,0x03,0x81,0xC0,0x07,0x00,0xE0,0x07,0x00,0xE0,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0C,0x00,0x30,0x00,0x00,0x00,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // t
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x00,0xFF,0x80,0x01,0xDB,0x80,0x03,0x99,0xC0,0x03,0x9D,0xC0,0x07,0x1C,0xE0,0x07,0x1C,0xE0,0x0E,0x1C,0x70,0x0E,0x1C,0x70,0x0C,0x1C,0x30,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // u
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x0C,0x1C,0x30,0x0E,0x1C,0x70,0x0E,0x1C,0x70,0x07,0x1C,0xE0,0x07,0x1C,0xE0,0x03,0x9D,0xC0,0x03,0x99,0xC0,0x01,0xDB,0x80,0x00,0xFF,0x80,0x00,0xFF,0x00,0x00,0x7F,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // v
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x18,0x04,0x70,0x18,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x18,0x0E,0x77,0xDB,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xDB,0xFE,0x70,0x18,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x1C,0x0E,0x70,0x18,0x0E,0x20,0x18,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // w
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x1F,0xFF,0xF8,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x07,0xDB,0xE0,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x0F,0xDB,0xF0,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x1F,0xFF,0xF8,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // x
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xE7,0xFC,0x70,0x00,0x0E,0x7C,0x00,0x3E,0x7E,0x00,0x7E,0x7E,0x00,0x7E,0x77,0x00,0xEE,0x77,0x00,0xEE,0x73,0x81,0xCE,0x73,0x81,0xCE,0x71,0xC3,0x8E,0x70,0xC3,0x8E,0x70,0xC3,0x0E,0x70,0x43,0x0E,0x70,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0E,0x70,0x42,0x0E,0x70,0xC3,0x0E,0x70,0xC3,0x8E,0x71,0xC3,0x8E,0x73,0x81,0xCE,0x73,0x81,0xCE,0x77,0x00,0xEE,0x77,0x00,0xEE,0x7E,0x00,0x7E,0x7E,0x00,0x7E,0x7C,0x00,0x3E,0x70,0x00,0x0E,0x3F,0xE7,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // y
-0x00,0x00,0x00,0x0F,0xE7,0xF0,0x1F,0xE7,0xF8,0x3F,0xFF,0xFC,0x70,0x18,0x0E,0x7C,0x1C,0x3E,0x7E,0x1C,0x7E,0x7E,0x1C,0x7E,0x77,0x1C,0xEE,0x77,0x1C,0xEE,0x73,0x9D,0xCE,0x73,0x99,0xCE,0x71,0xDB,0x8E,0x70,0xFF,0x8E,0x70,0xFF,0x0E,0x70,0x7E,0x0E,0x77,0x18,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xDB,0xFE,0x70,0x7E,0x0E,0x70,0xFF,0x0E,0x70,0xFF,0x8E,0x71,0xDB,0x8E,0x73,0x99,0xCE,0x73,0x9D,0xCE,0x77,0x1C,0xEE,0x77,0x1C,0xEE,0x7E,0x1C,0x7E,0x7E,0x1C,0x7E,0x7C,0x1C,0x3E,0x70,0x18,0x0E,0x3F,0xFF,0xFC,0x1F,0xE7,0xF8,0x0F,0xE7,0xF0,0x00,0x00,0x00,  // z
-0x00,0x00,0x00,0x00,0x07,0xF0,0x00,0x07,0xF8,0x00,0x1F,0xF8,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x07,0xD8,0x00,0x1F,0xE0,0x00,0x1F,0xE0,0x00,0x0F,0xD8,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x1F,0xF8,0x00,0x07,0xF8,0x00,0x07,0xF0,0x00,0x00,0x00,  // {
-0x00,0x00,0x00,0x0F,0xE0,0x00,0x1F,0xE0,0x00,0x1F,0xF8,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x1F,0xF8,0x00,0x07,0xF8,0x00,0x07,0xF0,0x00,0x00,0x00,  // |
-0x00,0x00,0x00,0x0F,0xE0,0x00,0x1F,0xE0,0x00,0x1F,0xF8,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x00,0x1B,0xE0,0x00,0x07,0xF8,0x00,0x07,0xF8,0x00,0x1B,0xF0,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x18,0x00,0x1F,0xF8,0x00,0x1F,0xE0,0x00,0x0F,0xE0,0x00,0x00,0x00,0x00,  // }
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x07,0xC3,0xEE,0x1F,0xE7,0xF8,0x1F,0xE7,0xF8,0x7F,0xC3,0xF0,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // ~
+const unsigned char font_sixteen_segment_24x36[10260] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 32 < >
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 33 <!>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 34 <">
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xFF, 0x3F, 0x0E, 0x18, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x18, 0x70, 0xEE, 0xDB, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xDB, 0x7F, 0x0E, 0x18, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x18, 0x70, 0xFC, 0xFF, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 35 <#>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xFF, 0x1F, 0x0E, 0x18, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x18, 0x00, 0xEE, 0xDB, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xDB, 0x7F, 0x00, 0x18, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x18, 0x70, 0xF8, 0xFF, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 36 <$>
+    0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xFC, 0x1F, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x38, 0x0C, 0x0E, 0x38, 0x0E, 0x0E, 0x38, 0x0E, 0x0E, 0x38, 0x07, 0x0E, 0x38, 0x07, 0x0E, 0xB8, 0x03, 0x0E, 0x98, 0x03, 0x0E, 0xD8, 0x01, 0x0E, 0xF8, 0x01, 0x0E, 0xF8, 0x00, 0x0E, 0x78, 0x00, 0xEE, 0x1B, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xDB, 0x7F, 0x00, 0x1E, 0x70, 0x00, 0x3F, 0x70, 0x00, 0x3F, 0x70, 0x80, 0x3B, 0x70, 0xC0, 0x39, 0x70, 0xC0, 0x39, 0x70, 0xE0, 0x38, 0x70, 0xE0, 0x38, 0x70, 0x70, 0x38, 0x70, 0x70, 0x38, 0x70, 0x30, 0x38, 0x70, 0x00, 0x18, 0x70, 0x00, 0xF8, 0x3F, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,  // Символ 37 <%>
+    0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xFC, 0x1F, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0xEE, 0x1B, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xFE, 0x03, 0x00, 0x0E, 0x40, 0x00, 0x0E, 0xC0, 0x00, 0x0E, 0xC0, 0x01, 0x0E, 0xC0, 0x01, 0x0E, 0x80, 0x03, 0x0E, 0x80, 0x03, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0C, 0x0E, 0x00, 0x00, 0xFC, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 38 <&>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 39 <'>
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,  // Символ 40 <(>
+    0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0xF8, 0x0F, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x07, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,  // Символ 41 <)>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x30, 0x38, 0x0C, 0x70, 0x38, 0x0E, 0x70, 0x38, 0x0E, 0xE0, 0x38, 0x07, 0xE0, 0x38, 0x07, 0xC0, 0xB9, 0x03, 0xC0, 0x99, 0x03, 0x80, 0xDB, 0x01, 0x00, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0xE0, 0x18, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xDB, 0x0F, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0x80, 0xDB, 0x01, 0xC0, 0x99, 0x03, 0xC0, 0xB9, 0x03, 0xE0, 0x38, 0x07, 0xE0, 0x38, 0x07, 0x70, 0x38, 0x0E, 0x70, 0x38, 0x0E, 0x30, 0x38, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 42 <*>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xE0, 0xDB, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xDB, 0x0F, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 43 <+>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 44 <,>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 45 <->
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00,  // Символ 46 <.>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 47 </>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x3F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x7C, 0x0E, 0x00, 0x7E, 0x0E, 0x00, 0x7E, 0x0E, 0x00, 0x77, 0x0E, 0x00, 0x77, 0x0E, 0x80, 0x73, 0x0E, 0x80, 0x73, 0x0E, 0xC0, 0x71, 0x0E, 0xC0, 0x71, 0x0E, 0xC0, 0x70, 0x0E, 0xC0, 0x70, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x0E, 0x02, 0x70, 0x0E, 0x03, 0x70, 0x0E, 0x03, 0x70, 0x8E, 0x03, 0x70, 0xCE, 0x01, 0x70, 0xCE, 0x01, 0x70, 0xEE, 0x00, 0x70, 0xEE, 0x00, 0x70, 0x7E, 0x00, 0x70, 0x7E, 0x00, 0x70, 0x3E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xFC, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 48 <0>
+    0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xF8, 0xFF, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 49 <1>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0xE0, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x0F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFC, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 50 <2>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0xE0, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x7F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0xF8, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 51 <3>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xEE, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x7F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 52 <4>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x1F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x7F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0xF8, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 53 <5>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x1F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x7F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xFC, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 54 <6>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 55 <7>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x3F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xEE, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x7F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xFC, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 56 <8>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x3F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xEE, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x7F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0xF8, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 57 <9>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 58 <:>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 59 <;>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x78, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 60 <<>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 61 <=>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 62 <>>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0xC0, 0x77, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x1F, 0x00, 0xD8, 0x0F, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 63 <?>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xFF, 0x3F, 0x0E, 0x18, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x18, 0x70, 0x0E, 0xD8, 0x77, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x1F, 0x0E, 0xC0, 0x0F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFC, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 64 <@>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x3F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xEE, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x7F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 65 <A>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xFF, 0x3F, 0x00, 0x18, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x18, 0x70, 0xE0, 0xDB, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xDB, 0x7F, 0x00, 0x18, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x18, 0x70, 0xF8, 0xFF, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 66 <B>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x1F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFC, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 67 <C>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xFF, 0x3F, 0x00, 0x18, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38, 0x70, 0x00, 0x18, 0x70, 0xF8, 0xFF, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 68 <D>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x1F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x0F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFC, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 69 <E>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x1F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x0F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 70 <F>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x1F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0xC0, 0x07, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x1F, 0x0E, 0xC0, 0x7F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xFC, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 71 <G>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xEE, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x7F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 72 <H>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xF8, 0xFF, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 73 <I>
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xFC, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 74 <J>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x07, 0x0E, 0x80, 0x03, 0x0E, 0x80, 0x03, 0x0E, 0xC0, 0x01, 0x0E, 0xC0, 0x01, 0x0E, 0xC0, 0x00, 0x0E, 0xC0, 0x00, 0xEE, 0x03, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xFE, 0x03, 0x00, 0x0E, 0x40, 0x00, 0x0E, 0xC0, 0x00, 0x0E, 0xC0, 0x01, 0x0E, 0xC0, 0x01, 0x0E, 0x80, 0x03, 0x0E, 0x80, 0x03, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0C, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 75 <K>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFC, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 76 <L>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x0E, 0x00, 0x70, 0x3E, 0x00, 0x7C, 0x7E, 0x00, 0x7E, 0x7E, 0x00, 0x7E, 0xEE, 0x00, 0x77, 0xEE, 0x00, 0x77, 0xCE, 0x81, 0x73, 0xCE, 0x81, 0x73, 0x8E, 0xC3, 0x71, 0x0E, 0xC3, 0x71, 0x0E, 0xC3, 0x70, 0x0E, 0xC2, 0x70, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x18, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x18, 0x70, 0x04, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 77 <M>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x0E, 0x00, 0x70, 0x3E, 0x00, 0x70, 0x7E, 0x00, 0x70, 0x7E, 0x00, 0x70, 0xEE, 0x00, 0x70, 0xEE, 0x00, 0x70, 0xCE, 0x01, 0x70, 0xCE, 0x01, 0x70, 0x8E, 0x03, 0x70, 0x0E, 0x03, 0x70, 0x0E, 0x03, 0x70, 0x0E, 0x02, 0x70, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x0E, 0x40, 0x70, 0x0E, 0xC0, 0x70, 0x0E, 0xC0, 0x71, 0x0E, 0xC0, 0x71, 0x0E, 0x80, 0x73, 0x0E, 0x80, 0x73, 0x0E, 0x00, 0x77, 0x0E, 0x00, 0x77, 0x0E, 0x00, 0x7E, 0x0E, 0x00, 0x7E, 0x0E, 0x00, 0x7C, 0x0E, 0x00, 0x70, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 78 <N>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x3F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xFC, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 79 <O>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x3F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xEE, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x0F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 80 <P>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x3F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x0E, 0x40, 0x70, 0x0E, 0xC0, 0x70, 0x0E, 0xC0, 0x71, 0x0E, 0xC0, 0x71, 0x0E, 0x80, 0x73, 0x0E, 0x80, 0x73, 0x0E, 0x00, 0x77, 0x0E, 0x00, 0x77, 0x0E, 0x00, 0x7E, 0x0E, 0x00, 0x7E, 0x0E, 0x00, 0x7C, 0x0E, 0x00, 0x70, 0xFC, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 81 <Q>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x3F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xEE, 0x03, 0x70, 0xF8, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xFE, 0x03, 0x00, 0x0E, 0x40, 0x00, 0x0E, 0xC0, 0x00, 0x0E, 0xC0, 0x01, 0x0E, 0xC0, 0x01, 0x0E, 0x80, 0x03, 0x0E, 0x80, 0x03, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0C, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 82 <R>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x1F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x7F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0xF8, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 83 <S>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 84 <T>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xFC, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 85 <U>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x0C, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x0E, 0x0E, 0x00, 0x07, 0x0E, 0x00, 0x07, 0x0E, 0x80, 0x03, 0x0E, 0x80, 0x03, 0x0E, 0xC0, 0x01, 0x0E, 0xC0, 0x01, 0x0E, 0xC0, 0x00, 0x0E, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x02, 0x00, 0x0E, 0x03, 0x00, 0x0E, 0x03, 0x00, 0x8E, 0x03, 0x00, 0xCE, 0x01, 0x00, 0xCE, 0x01, 0x00, 0xEE, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 86 <V>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x18, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x18, 0x70, 0xFC, 0xFF, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 87 <W>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x0C, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x81, 0x03, 0xC0, 0x81, 0x03, 0x80, 0xC3, 0x01, 0x00, 0xC3, 0x01, 0x00, 0xC3, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0xC3, 0x00, 0x00, 0xC3, 0x01, 0x80, 0xC3, 0x01, 0xC0, 0x81, 0x03, 0xC0, 0x81, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x30, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 88 <X>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x0C, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x81, 0x03, 0xC0, 0x81, 0x03, 0x80, 0xC3, 0x01, 0x00, 0xC3, 0x01, 0x00, 0xC3, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 89 <Y>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 90 <Z>
+    0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0xF8, 0x0F, 0x00, 0xFC, 0x07, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xFC, 0x07, 0x00, 0xF8, 0x0F, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,  // Символ 91 <[>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 92 <\>
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0xE0, 0x3F, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,  // Символ 93 <]>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x00, 0xC3, 0x00, 0x80, 0xC3, 0x01, 0x80, 0xC3, 0x01, 0xC0, 0x81, 0x03, 0xC0, 0x81, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x0F, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0C, 0x30, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 94 <^>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 95 <_>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 96 <`>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 97 <a>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0xFF, 0x00, 0x80, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0xC0, 0xFF, 0x03, 0xC0, 0xFF, 0x03, 0xC0, 0xFF, 0x03, 0xC0, 0xFF, 0x03, 0x80, 0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 98 <b>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xF8, 0xFF, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 99 <c>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0xEE, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x0F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 100 <d>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0xE0, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x7F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 101 <e>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xFE, 0x1B, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x18, 0x00, 0xFC, 0x1F, 0x00, 0xF8, 0x07, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,  // Символ 102 <f>
+    0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xFC, 0x1F, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0x0E, 0x38, 0x00, 0xEE, 0x1B, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 103 <g>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x3F, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 104 <h>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0xF8, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 105 <i>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xDB, 0x7F, 0x0E, 0x18, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x18, 0x70, 0xFC, 0xFF, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 106 <j>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 107 <k>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 108 <l>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 109 <m>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 110 <n>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xC3, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xC3, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 111 <o>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 112 <p>
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x1F, 0x00, 0xF8, 0x1F, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xF8, 0x1F, 0x00, 0xF8, 0x07, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,  // Символ 113 <q>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xE0, 0xDB, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xDB, 0x0F, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xF8, 0xFF, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 114 <r>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x20, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0x0E, 0x00, 0x70, 0xEE, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x0F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 115 <s>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0x00, 0x00, 0x00, 0x30, 0x00, 0x0C, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0xC0, 0x81, 0x03, 0xC0, 0x81, 0x03, 0x80, 0xC3, 0x01, 0x00, 0xC3, 0x01, 0x00, 0xC3, 0x00, 0x00, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, 0xC3, 0x00, 0x00, 0xC3, 0x01, 0x80, 0xC3, 0x01, 0xC0, 0x81, 0x03, 0xC0, 0x81, 0x03, 0xE0, 0x00, 0x07, 0xE0, 0x00, 0x07, 0x70, 0x00, 0x0E, 0x70, 0x00, 0x0E, 0x30, 0x00, 0x0C, 0x00, 0x00, 0x00, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 116 <t>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x7E, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0x80, 0xDB, 0x01, 0xC0, 0x99, 0x03, 0xC0, 0xB9, 0x03, 0xE0, 0x38, 0x07, 0xE0, 0x38, 0x07, 0x70, 0x38, 0x0E, 0x70, 0x38, 0x0E, 0x30, 0x38, 0x0C, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 117 <u>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x30, 0x38, 0x0C, 0x70, 0x38, 0x0E, 0x70, 0x38, 0x0E, 0xE0, 0x38, 0x07, 0xE0, 0x38, 0x07, 0xC0, 0xB9, 0x03, 0xC0, 0x99, 0x03, 0x80, 0xDB, 0x01, 0x00, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 118 <v>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x18, 0x20, 0x0E, 0x18, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x18, 0x70, 0xEE, 0xDB, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xDB, 0x7F, 0x0E, 0x18, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x38, 0x70, 0x0E, 0x18, 0x70, 0x04, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 119 <w>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xF8, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xE0, 0xDB, 0x07, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xDB, 0x0F, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xF8, 0xFF, 0x1F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 120 <x>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xE7, 0x3F, 0x0E, 0x00, 0x70, 0x3E, 0x00, 0x7C, 0x7E, 0x00, 0x7E, 0x7E, 0x00, 0x7E, 0xEE, 0x00, 0x77, 0xEE, 0x00, 0x77, 0xCE, 0x81, 0x73, 0xCE, 0x81, 0x73, 0x8E, 0xC3, 0x71, 0x0E, 0xC3, 0x71, 0x0E, 0xC3, 0x70, 0x0E, 0xC2, 0x70, 0x0E, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x0E, 0x42, 0x70, 0x0E, 0xC3, 0x70, 0x0E, 0xC3, 0x71, 0x8E, 0xC3, 0x71, 0xCE, 0x81, 0x73, 0xCE, 0x81, 0x73, 0xEE, 0x00, 0x77, 0xEE, 0x00, 0x77, 0x7E, 0x00, 0x7E, 0x7E, 0x00, 0x7E, 0x3E, 0x00, 0x7C, 0x0E, 0x00, 0x70, 0xFC, 0xE7, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 121 <y>
+    0x00, 0x00, 0x00, 0xF0, 0xE7, 0x0F, 0xF8, 0xE7, 0x1F, 0xFC, 0xFF, 0x3F, 0x0E, 0x18, 0x70, 0x3E, 0x38, 0x7C, 0x7E, 0x38, 0x7E, 0x7E, 0x38, 0x7E, 0xEE, 0x38, 0x77, 0xEE, 0x38, 0x77, 0xCE, 0xB9, 0x73, 0xCE, 0x99, 0x73, 0x8E, 0xDB, 0x71, 0x0E, 0xFF, 0x71, 0x0E, 0xFF, 0x70, 0x0E, 0x7E, 0x70, 0xEE, 0x18, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xDB, 0x7F, 0x0E, 0x7E, 0x70, 0x0E, 0xFF, 0x70, 0x0E, 0xFF, 0x71, 0x8E, 0xDB, 0x71, 0xCE, 0x99, 0x73, 0xCE, 0xB9, 0x73, 0xEE, 0x38, 0x77, 0xEE, 0x38, 0x77, 0x7E, 0x38, 0x7E, 0x7E, 0x38, 0x7E, 0x3E, 0x38, 0x7C, 0x0E, 0x18, 0x70, 0xFC, 0xFF, 0x3F, 0xF8, 0xE7, 0x1F, 0xF0, 0xE7, 0x0F, 0x00, 0x00, 0x00,  // Символ 122 <z>
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0xE0, 0x1F, 0x00, 0xF8, 0x1F, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0xE0, 0x1B, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xF0, 0x1B, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,  // Символ 123 <{>
+    0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,  // Символ 124 <|>
+    0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0xF8, 0x07, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0xD8, 0x07, 0x00, 0xE0, 0x1F, 0x00, 0xE0, 0x1F, 0x00, 0xD8, 0x0F, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0xF8, 0x1F, 0x00, 0xF8, 0x07, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,  // Символ 125 <}>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0xE0, 0xC3, 0x77, 0xF8, 0xE7, 0x1F, 0xF8, 0xE7, 0x1F, 0xFE, 0xC3, 0x0F, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // Символ 126 <~>
 };
 
+// описание шрифта для print_char_font()
+const st7735_font fd_sixteen_segment_24x36 = { font_sixteen_segment_24x36, 0, 108, 24, 36, 32, 95, BITS_RB, 0 };
 
-const unsigned int SixteenSegment24x36idx[255] = {
-0, //   0
-0, //   1
-0, //   2
-0, //   3
-0, //   4
-0, //   5
-0, //   6
-0, //   7
-0, //   8
-0, //   9
-0, //  10
-0, //  11
-0, //  12
-0, //  13
-0, //  14
-0, //  15
-0, //  16
-0, //  17
-0, //  18
-0, //  19
-0, //  20
-0, //  21
-0, //  22
-0, //  23
-0, //  24
-0, //  25
-0, //  26
-0, //  27
-0, //  28
-0, //  29
-0, //  30
-0, //  31
-
-108	,	 //  space (32)
-216	,	 //  33 '!'
-324	,	 //  34
-432	,	 //  35
-540	,	 //  36
-648	,	 //  37
-756	,	 //  38
-864	,	 //  39
-972	,	 //  40
-1080	,	 //  41
-1188	,	 //  42
-1296	,	 //  43
-1404	,	 //  44
-1512	,	 //  45
-1620	,	 //  46 '.'
-1728	,	 //  47
-1836	,	 //  48 '0'
-1944	,	 //  49 '1'
-2052	,	 //  50 '2'
-2160	,	 //  51 '3'
-2268	,	 //  52 '4'
-2376	,	 //  53 '5'
-2484	,	 //  54 '6'
-2592	,	 //  55 '7'
-2700	,	 //  56 '8'
-2808	,	 //  57 '9'
-2916	,	 //  58 ':'
-3024	,	 //  59
-3132	,	 //  60
-3240	,	 //  61
-3348	,	 //  62
-3456	,	 //  63
-3564	,	 //  64
-3672	,	 //  65
-3780	,	 //  66
-3888	,	 //  67
-3996	,	 //  68
-4104	,	 //  69
-4212	,	 //  70
-4320	,	 //  71
-4428	,	 //  72
-4536	,	 //  73
-4644	,	 //  74
-4752	,	 //  75
-4860	,	 //  76
-4968	,	 //  77
-5076	,	 //  78
-5184	,	 //  79
-5292	,	 //  80
-5400	,	 //  81
-5508	,	 //  82
-5616	,	 //  83
-5724	,	 //  84
-5832	,	 //  85
-5940	,	 //  86
-6048	,	 //  87
-6156	,	 //  88
-6264	,	 //  89
-6372	,	 //  90
-6480	,	 //  91
-6588	,	 //  92
-6696	,	 //  93
-6804	,	 //  94
-6912	,	 //  95
-7020	,	 //  96
-7128	,	 //  97
-7236	,	 //  98
-7344	,	 //  99
-7452	,	 // 100
-7560	,	 // 101
-7668	,	 // 102
-7776	,	 // 103
-7884	,	 // 104
-7992	,	 // 105
-8100	,	 // 106
-8208	,	 // 107
-8316	,	 // 108
-8424	,	 // 109
-8532	,	 // 110
-8640	,	 // 111
-8748	,	 // 112
-8856	,	 // 113
-8964	,	 // 114
-9072	,	 // 115
-9180	,	 // 116
-9288	,	 // 117
-9396	,	 // 118
-9504	,	 // 119
-9612	,	 // 120
-9720	,	 // 121
-9828	,	 // 122
-9936	,	 // 123
-10044	,	 // 124
-10152	,	 // 125
-10260	,	 // 126
-
-0, // 127
-0, // 128
-0, // 129
-0, // 130
-0, // 131
-0, // 132
-0, // 133
-0, // 134
-0, // 135
-0, // 136
-0, // 137
-0, // 138
-0, // 139
-0, // 140
-0, // 141
-0, // 142
-0, // 143
-0, // 144
-0, // 145
-0, // 146
-0, // 147
-0, // 148
-0, // 149
-0, // 150
-0, // 151
-0, // 152
-0, // 153
-0, // 154
-0, // 155
-0, // 156
-0, // 157
-0, // 158
-0, // 159
-0, // 160
-0, // 161
-0, // 162
-0, // 163
-0, // 164
-0, // 165
-0, // 166
-0, // 167
-0, // 168
-0, // 169
-0, // 150
-0, // 171
-0, // 172
-0, // 173
-0, // 174
-0, // 175
-0, // 176
-0, // 177
-0, // 178
-0, // 179
-0, // 180
-0, // 181
-0, // 182
-0, // 183
-0, // 184
-0, // 185
-0, // 186
-0, // 187
-0, // 188
-0, // 189
-0, // 190
-0, // 191
-0, // 192
-0, // 193
-0, // 194
-0, // 195
-0, // 196
-0, // 197
-0, // 198
-0, // 199
-0, // 200
-0, // 201
-0, // 202
-0, // 203
-0, // 204
-0, // 205
-0, // 206
-0, // 207
-0, // 208
-0, // 209
-0, // 210
-0, // 211
-0, // 212
-0, // 213
-0, // 214
-0, // 215
-0, // 216
-0, // 217
-0, // 218
-0, // 219
-0, // 220
-0, // 221
-0, // 222
-0, // 223
-0, // 224
-0, // 225
-0, // 226
-0, // 227
-0, // 228
-0, // 229
-0, // 230
-0, // 231
-0, // 232
-0, // 233
-0, // 234
-0, // 235
-0, // 236
-0, // 237
-0, // 238
-0, // 239
-0, // 240
-0, // 241
-0, // 242
-0, // 243
-0, // 244
-0, // 245
-0, // 246
-0, // 247
-0, // 248
-0, // 249
-0, // 250
-0, // 251
-0, // 252
-0, // 253
-0, // 254
-};
\ No newline at end of file
+#endif // FONT_SIXTEEN_SEGMENT_24X36_H
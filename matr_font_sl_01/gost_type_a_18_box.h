@@ -0,0 +1,260 @@
+// GOST type A 18 (из gost_type_a_18_font.h), матрицы обрезаны по рамке изображения (ST7735_FONT_BOX):
+// у каждого символа 4 байта рамки {x, y, ширина, высота}, затем только точки внутри рамки
+// 4525 байт матриц + 448 байт смещений вместо 15456, сгенерировано tools/fontc
+
+#ifndef FONT_GOST_TYPE_A_18_BOX_H
+#define FONT_GOST_TYPE_A_18_BOX_H
+
+#include "lcd7735sl.h"
+
+const unsigned char font_gost_type_a_18_box[4525] =
+{
+    0x00, 0x00, 0x00, 0x00,  // Символ 32 < >
+    0x08, 0x02, 0x02, 0x10, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00, 0x03,  // Символ 33 <!>
+    0x06, 0x02, 0x05, 0x03, 0x1F, 0x0F, 0x0F,  // Символ 34 <">
+    0x03, 0x02, 0x0C, 0x10, 0x60, 0x06, 0x30, 0x06, 0x30, 0x07, 0x30, 0x03, 0xFE, 0x0F, 0x38, 0x03, 0x18, 0x03, 0x98, 0x03, 0x98, 0x01, 0x98, 0x01, 0x9C, 0x01, 0xFF, 0x07, 0xCC, 0x01, 0xCC, 0x00, 0xCC, 0x00, 0xC6, 0x00,  // Символ 35 <#>
+    0x04, 0x01, 0x0A, 0x13, 0x30, 0x00, 0xFC, 0x01, 0x36, 0x03, 0x33, 0x00, 0x33, 0x00, 0x33, 0x00, 0x3E, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xB0, 0x01, 0xB0, 0x01, 0xB0, 0x01, 0xF0, 0x00, 0xFF, 0x00, 0x30, 0x00, 0x30, 0x00,  // Символ 36 <$>
+    0x00, 0x00, 0x00, 0x00,  // Символ 37 <%>
+    0x03, 0x02, 0x0C, 0x10, 0x3C, 0x00, 0x66, 0x00, 0x66, 0x00, 0x7C, 0x00, 0x38, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x3C, 0x00, 0x66, 0x00, 0x67, 0x00, 0xC3, 0x0E, 0x83, 0x07, 0x83, 0x03, 0x87, 0x03, 0xCE, 0x07, 0x7C, 0x0E,  // Символ 38 <&>
+    0x08, 0x02, 0x02, 0x04, 0x03, 0x03, 0x03, 0x03,  // Символ 39 <'>
+    0x07, 0x01, 0x04, 0x12, 0x0E, 0x06, 0x06, 0x06, 0x06, 0x07, 0x07, 0x07, 0x03, 0x03, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0C,  // Символ 40 <(>
+    0x07, 0x01, 0x03, 0x12, 0x03, 0x03, 0x03, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03, 0x03, 0x03,  // Символ 41 <)>
+    0x06, 0x02, 0x06, 0x05, 0x1E, 0x0E, 0x3F, 0x1C, 0x1E,  // Символ 42 <*>
+    0x05, 0x08, 0x08, 0x08, 0x18, 0x18, 0x18, 0x18, 0xFF, 0x18, 0x18, 0x18,  // Символ 43 <+>
+    0x08, 0x11, 0x02, 0x04, 0x03, 0x03, 0x03, 0x03,  // Символ 44 <,>
+    0x04, 0x0B, 0x09, 0x01, 0xFF, 0x01,  // Символ 45 <->
+    0x08, 0x10, 0x02, 0x02, 0x03, 0x03,  // Символ 46 <.>
+    0x03, 0x01, 0x0B, 0x14, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x38, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00,  // Символ 47 </>
+    0x04, 0x02, 0x09, 0x10, 0x7C, 0x00, 0xC6, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC6, 0x00, 0x7C, 0x00,  // Символ 48 <0>
+    0x06, 0x02, 0x06, 0x10, 0x38, 0x3C, 0x3E, 0x37, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,  // Символ 49 <1>
+    0x04, 0x02, 0x09, 0x10, 0x7C, 0x00, 0xC6, 0x00, 0x87, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x38, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0xFF, 0x01,  // Символ 50 <2>
+    0x05, 0x02, 0x08, 0x10, 0x3F, 0x70, 0x60, 0x60, 0x60, 0x70, 0x3C, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x3F,  // Символ 51 <3>
+    0x04, 0x02, 0x09, 0x10, 0x18, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x66, 0x00, 0x66, 0x00, 0x66, 0x00, 0x67, 0x00, 0xFF, 0x01, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,  // Символ 52 <4>
+    0x05, 0x02, 0x08, 0x10, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x60, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x60, 0x3F,  // Символ 53 <5>
+    0x04, 0x02, 0x09, 0x10, 0x70, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x7F, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC6, 0x00, 0x7C, 0x00,  // Символ 54 <6>
+    0x04, 0x02, 0x09, 0x10, 0xFF, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,  // Символ 55 <7>
+    0x04, 0x02, 0x09, 0x10, 0x7C, 0x00, 0xCE, 0x00, 0x86, 0x01, 0x86, 0x01, 0x86, 0x01, 0xCE, 0x01, 0xFC, 0x00, 0x66, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC6, 0x00, 0x7C, 0x00,  // Символ 56 <8>
+    0x04, 0x02, 0x09, 0x10, 0x7C, 0x00, 0xC7, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x87, 0x01, 0xFC, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x38, 0x00, 0x1C, 0x00,  // Символ 57 <9>
+    0x08, 0x06, 0x02, 0x08, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,  // Символ 58 <:>
+    0x08, 0x0A, 0x02, 0x0B, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03,  // Символ 59 <;>
+    0x05, 0x08, 0x08, 0x08, 0xC0, 0xF0, 0x3C, 0x0F, 0x0F, 0x3C, 0xF0, 0xC0,  // Символ 60 <<>
+    0x05, 0x09, 0x08, 0x06, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF,  // Символ 61 <=>
+    0x05, 0x08, 0x08, 0x08, 0x07, 0x0E, 0x38, 0xE0, 0xE0, 0x38, 0x0E, 0x07,  // Символ 62 <>>
+    0x04, 0x02, 0x09, 0x10, 0x7E, 0x00, 0xC3, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x01, 0xE0, 0x00, 0x38, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00,  // Символ 63 <?>
+    0x00, 0x00, 0x00, 0x00,  // Символ 64 <@>
+    0x03, 0x02, 0x0B, 0x10, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x78, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xDC, 0x00, 0xDC, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0xFE, 0x01, 0x86, 0x03, 0x06, 0x03, 0x07, 0x03, 0x03, 0x07,  // Символ 65 <A>
+    0x04, 0x02, 0x09, 0x10, 0x7F, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x01, 0xFF, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x00, 0x7F, 0x00,  // Символ 66 <B>
+    0x05, 0x02, 0x08, 0x10, 0xFC, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0xFC,  // Символ 67 <C>
+    0x04, 0x02, 0x09, 0x10, 0x7F, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x00, 0x7F, 0x00,  // Символ 68 <D>
+    0x05, 0x02, 0x08, 0x10, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF,  // Символ 69 <E>
+    0x05, 0x02, 0x08, 0x10, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 70 <F>
+    0x04, 0x02, 0x09, 0x10, 0xFC, 0x01, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0xF3, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x86, 0x01, 0xFC, 0x01,  // Символ 71 <G>
+    0x04, 0x02, 0x09, 0x10, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xFF, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,  // Символ 72 <H>
+    0x08, 0x02, 0x02, 0x10, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 73 <I>
+    0x05, 0x02, 0x07, 0x10, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0x1F,  // Символ 74 <J>
+    0x04, 0x02, 0x09, 0x10, 0x83, 0x01, 0xC3, 0x01, 0xE3, 0x00, 0x73, 0x00, 0x33, 0x00, 0x3B, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x37, 0x00, 0x33, 0x00, 0x63, 0x00, 0x63, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x01, 0x83, 0x01,  // Символ 75 <K>
+    0x05, 0x02, 0x07, 0x10, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7F,  // Символ 76 <L>
+    0x03, 0x02, 0x0C, 0x10, 0x03, 0x0C, 0x07, 0x0E, 0x0F, 0x0F, 0x9B, 0x0D, 0xDB, 0x0C, 0xF3, 0x0C, 0x63, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C,  // Символ 77 <M>
+    0x04, 0x02, 0x09, 0x10, 0x83, 0x01, 0x87, 0x01, 0x87, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x9F, 0x01, 0x9B, 0x01, 0x9B, 0x01, 0xB3, 0x01, 0xB3, 0x01, 0xE3, 0x01, 0xE3, 0x01, 0xE3, 0x01, 0xC3, 0x01, 0xC3, 0x01, 0x83, 0x01,  // Символ 78 <N>
+    0x04, 0x02, 0x09, 0x10, 0x7C, 0x00, 0xC6, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC6, 0x00, 0x7C, 0x00,  // Символ 79 <O>
+    0x04, 0x02, 0x09, 0x10, 0x7F, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x01, 0x7F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 80 <P>
+    0x04, 0x02, 0x0A, 0x10, 0x7C, 0x00, 0xC6, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x9B, 0x01, 0xB3, 0x01, 0xE3, 0x01, 0xC3, 0x01, 0xC7, 0x01, 0xFE, 0x03,  // Символ 81 <Q>
+    0x04, 0x02, 0x09, 0x10, 0x7F, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x01, 0xFF, 0x00, 0x3B, 0x00, 0x73, 0x00, 0x73, 0x00, 0x63, 0x00, 0xE3, 0x00, 0xC3, 0x00, 0xC3, 0x01, 0x83, 0x01,  // Символ 82 <R>
+    0x04, 0x02, 0x09, 0x10, 0xFC, 0x01, 0x86, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0x7F, 0x00,  // Символ 83 <S>
+    0x04, 0x02, 0x0A, 0x10, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,  // Символ 84 <T>
+    0x04, 0x02, 0x09, 0x10, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC6, 0x00, 0x7C, 0x00,  // Символ 85 <U>
+    0x03, 0x02, 0x0B, 0x10, 0x03, 0x07, 0x07, 0x03, 0x06, 0x03, 0x86, 0x03, 0x8E, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0xCC, 0x01, 0xDC, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0x30, 0x00,  // Символ 86 <V>
+    0x01, 0x02, 0x0F, 0x10, 0x03, 0x60, 0x07, 0x60, 0x06, 0x60, 0x06, 0x70, 0x86, 0x31, 0xC6, 0x31, 0xCE, 0x31, 0xCC, 0x33, 0xEC, 0x3B, 0x6C, 0x1B, 0x6C, 0x1F, 0x7C, 0x1E, 0x38, 0x1E, 0x38, 0x1E, 0x38, 0x0C, 0x18, 0x0C,  // Символ 87 <W>
+    0x04, 0x02, 0x0A, 0x10, 0x03, 0x03, 0x87, 0x01, 0x86, 0x01, 0xCC, 0x00, 0xFC, 0x00, 0x78, 0x00, 0x38, 0x00, 0x30, 0x00, 0x78, 0x00, 0x78, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0x86, 0x01, 0x86, 0x01, 0x87, 0x03, 0x03, 0x03,  // Символ 88 <X>
+    0x04, 0x02, 0x0A, 0x10, 0x03, 0x03, 0x87, 0x03, 0x86, 0x01, 0xCE, 0x01, 0xCC, 0x00, 0x78, 0x00, 0x78, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,  // Символ 89 <Y>
+    0x04, 0x02, 0x09, 0x10, 0xFF, 0x01, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x38, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x06, 0x00, 0xFF, 0x01,  // Символ 90 <Z>
+    0x07, 0x01, 0x04, 0x12, 0x0F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x0F,  // Символ 91 <[>
+    0x04, 0x01, 0x0B, 0x14, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x38, 0x00, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00, 0xE0, 0x00, 0xC0, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06,  // Символ 92 <\>
+    0x07, 0x01, 0x04, 0x12, 0x0F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0F,  // Символ 93 <]>
+    0x00, 0x00, 0x00, 0x00,  // Символ 94 <^>
+    0x04, 0x13, 0x0A, 0x01, 0xFF, 0x03,  // Символ 95 <_>
+    0x00, 0x00, 0x00, 0x00,  // Символ 96 <`>
+    0x04, 0x06, 0x09, 0x0C, 0xFE, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xFE, 0x01,  // Символ 97 <a>
+    0x05, 0x02, 0x08, 0x10, 0x03, 0x03, 0x03, 0x03, 0x7F, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7F,  // Символ 98 <b>
+    0x05, 0x06, 0x08, 0x0C, 0xFE, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFE,  // Символ 99 <c>
+    0x05, 0x02, 0x08, 0x10, 0xC0, 0xC0, 0xC0, 0xC0, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE,  // Символ 100 <d>
+    0x05, 0x06, 0x08, 0x0C, 0x7E, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x03, 0x03, 0x03, 0x03, 0xFE,  // Символ 101 <e>
+    0x06, 0x02, 0x06, 0x10, 0x3C, 0x06, 0x06, 0x06, 0x3F, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,  // Символ 102 <f>
+    0x05, 0x06, 0x08, 0x10, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xC0, 0xC0, 0xC0, 0x7F,  // Символ 103 <g>
+    0x05, 0x02, 0x08, 0x10, 0x03, 0x03, 0x03, 0x03, 0x7F, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,  // Символ 104 <h>
+    0x08, 0x02, 0x02, 0x10, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 105 <i>
+    0x06, 0x02, 0x05, 0x14, 0x18, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0F,  // Символ 106 <j>
+    0x05, 0x02, 0x08, 0x10, 0x03, 0x03, 0x03, 0x03, 0xC3, 0xE3, 0x73, 0x3B, 0x1F, 0x0F, 0x1F, 0x1B, 0x33, 0x73, 0x63, 0xC3,  // Символ 107 <k>
+    0x06, 0x02, 0x05, 0x10, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x1E,  // Символ 108 <l>
+    0x03, 0x06, 0x0C, 0x0C, 0xFF, 0x07, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C,  // Символ 109 <m>
+    0x05, 0x06, 0x08, 0x0C, 0x7F, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,  // Символ 110 <n>
+    0x05, 0x06, 0x08, 0x0C, 0x7E, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7E,  // Символ 111 <o>
+    0x05, 0x06, 0x08, 0x10, 0x7F, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7F, 0x03, 0x03, 0x03, 0x03,  // Символ 112 <p>
+    0x05, 0x06, 0x08, 0x10, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0,  // Символ 113 <q>
+    0x05, 0x06, 0x07, 0x0C, 0x3F, 0x73, 0x63, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 114 <r>
+    0x05, 0x06, 0x08, 0x0C, 0x7E, 0xE3, 0xC3, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0xC3, 0x7E,  // Символ 115 <s>
+    0x06, 0x02, 0x06, 0x10, 0x06, 0x06, 0x06, 0x06, 0x3F, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,  // Символ 116 <t>
+    0x05, 0x06, 0x08, 0x0C, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE,  // Символ 117 <u>
+    0x05, 0x06, 0x08, 0x0C, 0xC3, 0xC7, 0xE6, 0x66, 0x66, 0x6E, 0x7C, 0x3C, 0x3C, 0x38, 0x38, 0x18,  // Символ 118 <v>
+    0x02, 0x06, 0x0D, 0x0C, 0x03, 0x18, 0x07, 0x1C, 0xE6, 0x0C, 0xE6, 0x0C, 0xE6, 0x0C, 0xF6, 0x0D, 0xBE, 0x0F, 0xBC, 0x07, 0xBC, 0x07, 0x1C, 0x07, 0x1C, 0x07, 0x18, 0x07,  // Символ 119 <w>
+    0x05, 0x06, 0x08, 0x0C, 0xC3, 0xC7, 0x66, 0x6E, 0x7C, 0x3C, 0x38, 0x38, 0x3C, 0x6E, 0xE6, 0xC3,  // Символ 120 <x>
+    0x05, 0x06, 0x08, 0x10, 0xC3, 0xC7, 0xE6, 0x66, 0x66, 0x6C, 0x7C, 0x3C, 0x3C, 0x38, 0x18, 0x18, 0x18, 0x1C, 0x0C, 0x0F,  // Символ 121 <y>
+    0x05, 0x06, 0x08, 0x0C, 0xFF, 0xE0, 0x60, 0x70, 0x30, 0x38, 0x18, 0x1C, 0x0C, 0x0E, 0x06, 0xFF,  // Символ 122 <z>
+    0x06, 0x01, 0x05, 0x12, 0x1E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1C,  // Символ 123 <{>
+    0x08, 0x02, 0x02, 0x10, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 124 <|>
+    0x06, 0x01, 0x05, 0x12, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1C, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x03,  // Символ 125 <}>
+    0x04, 0x0A, 0x09, 0x04, 0x1E, 0x00, 0x1F, 0x00, 0xB3, 0x01, 0xE0, 0x01,  // Символ 126 <~>
+    0x00, 0x00, 0x00, 0x00,  // Символ 127 <>
+    0x00, 0x00, 0x00, 0x00,  // Символ 128 <Ђ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 129 <Ѓ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 130 <‚>
+    0x00, 0x00, 0x00, 0x00,  // Символ 131 <ѓ>
+    0x06, 0x11, 0x06, 0x04, 0x33, 0x3B, 0x1B, 0x1B,  // Символ 132 <„>
+    0x04, 0x11, 0x0A, 0x01, 0x33, 0x03,  // Символ 133 <…>
+    0x06, 0x05, 0x06, 0x0B, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C,  // Символ 134 <†>
+    0x06, 0x05, 0x06, 0x0B, 0x0C, 0x0C, 0x0C, 0x3F, 0x0C, 0x0C, 0x0C, 0x3F, 0x0C, 0x0C, 0x0C,  // Символ 135 <‡>
+    0x00, 0x00, 0x00, 0x00,  // Символ 136 <€>
+    0x00, 0x00, 0x00, 0x00,  // Символ 137 <‰>
+    0x00, 0x00, 0x00, 0x00,  // Символ 138 <Љ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 139 <‹>
+    0x00, 0x00, 0x00, 0x00,  // Символ 140 <Њ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 141 <Ќ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 142 <Ћ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 143 <Џ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 144 <ђ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 145 <‘>
+    0x00, 0x00, 0x00, 0x00,  // Символ 146 <’>
+    0x00, 0x00, 0x00, 0x00,  // Символ 147 <“>
+    0x00, 0x00, 0x00, 0x00,  // Символ 148 <”>
+    0x05, 0x08, 0x08, 0x08, 0xC3, 0xE6, 0x66, 0x3C, 0x3C, 0x1C, 0x7E, 0xC3,  // Символ 149 <•>
+    0x00, 0x00, 0x00, 0x00,  // Символ 150 <–>
+    0x00, 0x00, 0x00, 0x00,  // Символ 151 <—>
+    0x00, 0x00, 0x00, 0x00,  // Символ 152 <>
+    0x00, 0x00, 0x00, 0x00,  // Символ 153 <™>
+    0x00, 0x00, 0x00, 0x00,  // Символ 154 <љ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 155 <›>
+    0x00, 0x00, 0x00, 0x00,  // Символ 156 <њ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 157 <ќ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 158 <ћ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 159 <џ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 160 <>
+    0x00, 0x00, 0x00, 0x00,  // Символ 161 <Ў>
+    0x00, 0x00, 0x00, 0x00,  // Символ 162 <ў>
+    0x00, 0x00, 0x00, 0x00,  // Символ 163 <Ј>
+    0x00, 0x00, 0x00, 0x00,  // Символ 164 <¤>
+    0x00, 0x00, 0x00, 0x00,  // Символ 165 <Ґ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 166 <¦>
+    0x00, 0x00, 0x00, 0x00,  // Символ 167 <§>
+    0x05, 0x00, 0x08, 0x12, 0x66, 0x00, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF,  // Символ 168 <Ё>
+    0x00, 0x00, 0x00, 0x00,  // Символ 169 <©>
+    0x04, 0x02, 0x09, 0x10, 0xFC, 0x01, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x7F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0xFC, 0x01,  // Символ 170 <Є>
+    0x04, 0x07, 0x09, 0x0A, 0x98, 0x01, 0xDC, 0x00, 0xEC, 0x00, 0x66, 0x00, 0x33, 0x00, 0x33, 0x00, 0x66, 0x00, 0xEC, 0x00, 0xDC, 0x00, 0x98, 0x01,  // Символ 171 <«>
+    0x04, 0x0A, 0x09, 0x05, 0xFF, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,  // Символ 172 <¬>
+    0x00, 0x00, 0x00, 0x00,  // Символ 173 <>
+    0x00, 0x00, 0x00, 0x00,  // Символ 174 <®>
+    0x00, 0x00, 0x00, 0x00,  // Символ 175 <Ї>
+    0x06, 0x03, 0x05, 0x04, 0x1E, 0x1B, 0x1B, 0x1E,  // Символ 176 <°>
+    0x05, 0x07, 0x08, 0x0B, 0x18, 0x18, 0x18, 0xFF, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0xFF,  // Символ 177 <±>
+    0x00, 0x00, 0x00, 0x00,  // Символ 178 <І>
+    0x00, 0x00, 0x00, 0x00,  // Символ 179 <і>
+    0x00, 0x00, 0x00, 0x00,  // Символ 180 <ґ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 181 <µ>
+    0x03, 0x02, 0x0C, 0x14, 0xFC, 0x0F, 0x3E, 0x03, 0x3F, 0x03, 0x3F, 0x03, 0x3F, 0x03, 0x3F, 0x03, 0x3F, 0x03, 0x3E, 0x03, 0x3C, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03, 0x30, 0x03,  // Символ 182 <¶>
+    0x08, 0x0A, 0x02, 0x01, 0x03,  // Символ 183 <·>
+    0x05, 0x02, 0x08, 0x10, 0x66, 0x00, 0x00, 0x00, 0x7E, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x03, 0x03, 0x03, 0x03, 0xFE,  // Символ 184 <ё>
+    0x00, 0x00, 0x00, 0x00,  // Символ 185 <№>
+    0x00, 0x00, 0x00, 0x00,  // Символ 186 <є>
+    0x04, 0x07, 0x09, 0x0A, 0x3B, 0x00, 0x36, 0x00, 0x6E, 0x00, 0xFC, 0x00, 0xD8, 0x01, 0xD8, 0x01, 0xFC, 0x00, 0x6E, 0x00, 0x36, 0x00, 0x3B, 0x00,  // Символ 187 <»>
+    0x00, 0x00, 0x00, 0x00,  // Символ 188 <ј>
+    0x00, 0x00, 0x00, 0x00,  // Символ 189 <Ѕ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 190 <ѕ>
+    0x00, 0x00, 0x00, 0x00,  // Символ 191 <ї>
+    0x03, 0x02, 0x0B, 0x10, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00, 0x78, 0x00, 0xD8, 0x00, 0xD8, 0x00, 0xDC, 0x00, 0xDC, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0xFE, 0x01, 0x86, 0x03, 0x06, 0x03, 0x07, 0x03, 0x03, 0x07,  // Символ 192 <А>
+    0x04, 0x02, 0x09, 0x10, 0xFF, 0x01, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x7F, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x00, 0x7F, 0x00,  // Символ 193 <Б>
+    0x04, 0x02, 0x09, 0x10, 0x7F, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x01, 0xFF, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x00, 0x7F, 0x00,  // Символ 194 <В>
+    0x05, 0x02, 0x08, 0x10, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,  // Символ 195 <Г>
+    0x04, 0x02, 0x0A, 0x11, 0xFC, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x8C, 0x01, 0x8E, 0x01, 0x8E, 0x01, 0x8E, 0x01, 0x86, 0x01, 0xFF, 0x03, 0x03, 0x03,  // Символ 196 <Д>
+    0x05, 0x02, 0x08, 0x10, 0xFF, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFF,  // Символ 197 <Е>
+    0x03, 0x02, 0x0C, 0x10, 0x63, 0x0C, 0x67, 0x06, 0x6E, 0x07, 0x6C, 0x03, 0xFC, 0x01, 0xF8, 0x01, 0xF8, 0x00, 0xF0, 0x00, 0xF8, 0x01, 0xF8, 0x01, 0x78, 0x03, 0x6C, 0x03, 0x6C, 0x07, 0x66, 0x06, 0x66, 0x0E, 0x63, 0x0C,  // Символ 198 <Ж>
+    0x04, 0x02, 0x09, 0x10, 0x7C, 0x00, 0xC6, 0x01, 0x86, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x01, 0xF8, 0x00, 0xC0, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC6, 0x00, 0x7C, 0x00,  // Символ 199 <З>
+    0x04, 0x01, 0x09, 0x11, 0x03, 0x00, 0x83, 0x01, 0xC3, 0x01, 0xC3, 0x01, 0xE3, 0x01, 0xE3, 0x01, 0xE3, 0x01, 0xB3, 0x01, 0xB3, 0x01, 0x9B, 0x01, 0x9B, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x87, 0x01, 0x87, 0x01, 0x83, 0x01,  // Символ 200 <И>
+    0x04, 0x00, 0x09, 0x12, 0x7C, 0x00, 0x00, 0x00, 0x83, 0x01, 0xC3, 0x01, 0xC3, 0x01, 0xE3, 0x01, 0xE3, 0x01, 0xF3, 0x01, 0xB3, 0x01, 0xBB, 0x01, 0x9B, 0x01, 0x9B, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x87, 0x01, 0x87, 0x01, 0x83, 0x01,  // Символ 201 <Й>
+    0x04, 0x02, 0x09, 0x10, 0x83, 0x01, 0xC3, 0x01, 0xE3, 0x00, 0x73, 0x00, 0x33, 0x00, 0x3B, 0x00, 0x1F, 0x00, 0x3F, 0x00, 0x37, 0x00, 0x33, 0x00, 0x63, 0x00, 0x63, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x01, 0x83, 0x01,  // Символ 202 <К>
+    0x03, 0x02, 0x0B, 0x10, 0xE0, 0x07, 0x60, 0x06, 0x70, 0x06, 0x30, 0x06, 0x30, 0x06, 0x38, 0x06, 0x18, 0x06, 0x18, 0x06, 0x1C, 0x06, 0x0C, 0x06, 0x0C, 0x06, 0x0E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x06, 0x03, 0x06,  // Символ 203 <Л>
+    0x03, 0x02, 0x0C, 0x10, 0x03, 0x0C, 0x07, 0x0E, 0x0F, 0x0F, 0x9B, 0x0D, 0xDB, 0x0C, 0xF3, 0x0C, 0x63, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C,  // Символ 204 <М>
+    0x04, 0x02, 0x09, 0x10, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xFF, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,  // Символ 205 <Н>
+    0x04, 0x02, 0x09, 0x10, 0x7C, 0x00, 0xC6, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC6, 0x00, 0x7C, 0x00,  // Символ 206 <О>
+    0x04, 0x02, 0x09, 0x10, 0xFF, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,  // Символ 207 <П>
+    0x04, 0x02, 0x09, 0x10, 0x7F, 0x00, 0xC3, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x01, 0x7F, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,  // Символ 208 <Р>
+    0x05, 0x02, 0x08, 0x10, 0xFC, 0x06, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x06, 0xFC,  // Символ 209 <С>
+    0x04, 0x02, 0x0A, 0x10, 0xFF, 0x03, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,  // Символ 210 <Т>
+    0x04, 0x02, 0x09, 0x10, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x87, 0x01, 0xFC, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0x7E, 0x00,  // Символ 211 <У>
+    0x02, 0x02, 0x0E, 0x10, 0xC0, 0x00, 0xC0, 0x00, 0xF8, 0x07, 0xCE, 0x1C, 0xC6, 0x18, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC3, 0x30, 0xC6, 0x18, 0xCE, 0x1C, 0xF8, 0x07, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00,  // Символ 212 <Ф>
+    0x04, 0x02, 0x0A, 0x10, 0x03, 0x03, 0x87, 0x01, 0x86, 0x01, 0xCC, 0x00, 0xFC, 0x00, 0x78, 0x00, 0x38, 0x00, 0x30, 0x00, 0x78, 0x00, 0x78, 0x00, 0xCC, 0x00, 0xCC, 0x00, 0x86, 0x01, 0x86, 0x01, 0x87, 0x03, 0x03, 0x03,  // Символ 213 <Х>
+    0x04, 0x02, 0x0A, 0x13, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xFF, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,  // Символ 214 <Ц>
+    0x04, 0x02, 0x09, 0x10, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x87, 0x01, 0xFC, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,  // Символ 215 <Ч>
+    0x03, 0x02, 0x0C, 0x10, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFF, 0x0F,  // Символ 216 <Ш>
+    0x02, 0x02, 0x0D, 0x13, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFF, 0x1F, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,  // Символ 217 <Щ>
+    0x03, 0x02, 0x0C, 0x10, 0x0F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFC, 0x03, 0x0C, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0xFC, 0x03,  // Символ 218 <Ъ>
+    0x04, 0x02, 0x0A, 0x10, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x3F, 0x03, 0x63, 0x03, 0xC3, 0x03, 0xC3, 0x03, 0xC3, 0x03, 0xC3, 0x03, 0xC3, 0x03, 0xC3, 0x03, 0x63, 0x03, 0x7F, 0x03,  // Символ 219 <Ы>
+    0x04, 0x02, 0x09, 0x10, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x7F, 0x00, 0xC3, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xC3, 0x00, 0x7F, 0x00,  // Символ 220 <Ь>
+    0x04, 0x02, 0x09, 0x10, 0x7F, 0x00, 0xC0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xF8, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0x7F, 0x00,  // Символ 221 <Э>
+    0x04, 0x02, 0x0A, 0x10, 0xFB, 0x00, 0x9F, 0x01, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x0F, 0x03, 0x9B, 0x01, 0xF3, 0x00,  // Символ 222 <Ю>
+    0x04, 0x02, 0x09, 0x10, 0xFC, 0x01, 0x87, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x87, 0x01, 0xFC, 0x01, 0x98, 0x01, 0x98, 0x01, 0x9C, 0x01, 0x8C, 0x01, 0x8E, 0x01, 0x86, 0x01, 0x87, 0x01, 0x83, 0x01,  // Символ 223 <Я>
+    0x04, 0x06, 0x09, 0x0C, 0xFE, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xFE, 0x01,  // Символ 224 <а>
+    0x05, 0x02, 0x08, 0x10, 0xFF, 0x0E, 0x1C, 0x38, 0x7E, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7E,  // Символ 225 <б>
+    0x05, 0x02, 0x08, 0x10, 0x1E, 0x33, 0x33, 0x1F, 0x7F, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7E,  // Символ 226 <в>
+    0x05, 0x06, 0x08, 0x0C, 0x7E, 0xC3, 0xC3, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0xC3, 0x7E,  // Символ 227 <г>
+    0x05, 0x02, 0x08, 0x10, 0x7F, 0xC0, 0xC0, 0xC0, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7E,  // Символ 228 <д>
+    0x05, 0x06, 0x08, 0x0C, 0x7E, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0x03, 0x03, 0x03, 0x03, 0xFE,  // Символ 229 <е>
+    0x04, 0x06, 0x0A, 0x0C, 0x33, 0x03, 0xB7, 0x03, 0xB6, 0x01, 0xBC, 0x01, 0xFC, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0xF6, 0x01, 0xB7, 0x01, 0x33, 0x03,  // Символ 230 <ж>
+    0x05, 0x06, 0x08, 0x0C, 0x7C, 0xC6, 0xC6, 0xC0, 0xC0, 0x78, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0x7E,  // Символ 231 <з>
+    0x05, 0x06, 0x08, 0x0C, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE,  // Символ 232 <и>
+    0x04, 0x02, 0x09, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xFE, 0x01,  // Символ 233 <й>
+    0x05, 0x06, 0x08, 0x0C, 0xC3, 0x63, 0x33, 0x3B, 0x1F, 0x0F, 0x1F, 0x3B, 0x33, 0x73, 0xE3, 0xC3,  // Символ 234 <к>
+    0x05, 0x06, 0x08, 0x0C, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC7, 0xC3,  // Символ 235 <л>
+    0x04, 0x06, 0x09, 0x0C, 0x83, 0x01, 0xC7, 0x01, 0xC7, 0x01, 0xEF, 0x01, 0xFF, 0x01, 0xBB, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01,  // Символ 236 <м>
+    0x05, 0x06, 0x08, 0x0C, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,  // Символ 237 <н>
+    0x05, 0x06, 0x08, 0x0C, 0x7E, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7E,  // Символ 238 <о>
+    0x05, 0x06, 0x08, 0x0C, 0x7F, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,  // Символ 239 <п>
+    0x05, 0x06, 0x08, 0x10, 0x7F, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7F, 0x03, 0x03, 0x03, 0x03,  // Символ 240 <р>
+    0x05, 0x06, 0x08, 0x0C, 0xFE, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0xFE,  // Символ 241 <с>
+    0x03, 0x06, 0x0C, 0x0C, 0xFF, 0x07, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C,  // Символ 242 <т>
+    0x05, 0x06, 0x08, 0x10, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xC0, 0xC0, 0xC0, 0x7E,  // Символ 243 <у>
+    0x03, 0x04, 0x0C, 0x12, 0x60, 0x00, 0x60, 0x00, 0xFC, 0x03, 0x66, 0x06, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x66, 0x06, 0xFC, 0x03, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00,  // Символ 244 <ф>
+    0x05, 0x06, 0x08, 0x0C, 0xC3, 0xC7, 0x66, 0x6E, 0x7C, 0x3C, 0x38, 0x38, 0x3C, 0x6E, 0xE6, 0xC3,  // Символ 245 <х>
+    0x04, 0x06, 0x09, 0x0F, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xC3, 0x00, 0xFE, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,  // Символ 246 <ц>
+    0x05, 0x06, 0x08, 0x0C, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,  // Символ 247 <ч>
+    0x03, 0x06, 0x0C, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFE, 0x0F,  // Символ 248 <ш>
+    0x02, 0x06, 0x0D, 0x0F, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0xFE, 0x1F, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18,  // Символ 249 <щ>
+    0x04, 0x06, 0x0A, 0x0C, 0x0F, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0xFC, 0x01, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0x0C, 0x03, 0xFC, 0x01,  // Символ 250 <ъ>
+    0x04, 0x06, 0x09, 0x0C, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0xBF, 0x01, 0xE3, 0x01, 0xE3, 0x01, 0xE3, 0x01, 0xE3, 0x01, 0xE3, 0x01, 0xBF, 0x01,  // Символ 251 <ы>
+    0x05, 0x06, 0x08, 0x0C, 0x03, 0x03, 0x03, 0x03, 0x03, 0x7F, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x7F,  // Символ 252 <ь>
+    0x05, 0x06, 0x08, 0x0C, 0x7F, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x7F,  // Символ 253 <э>
+    0x04, 0x06, 0x09, 0x0C, 0xFB, 0x00, 0x8F, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0x8F, 0x01, 0xFB, 0x00,  // Символ 254 <ю>
+    0x05, 0x06, 0x08, 0x0C, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xDC, 0xCE, 0xCE, 0xC6, 0xC7, 0xC3   // Символ 255 <я>
+};
+
+// смещения матриц символов 32..255
+const uint16_t font_gost_type_a_18_boxidx[224] =
+{
+        0,     4,    24,    31,    67,   109,   113,   149,   157,   179,   201,   210,   222,   230,   236,   242,
+      286,   322,   342,   378,   398,   434,   454,   490,   526,   562,   598,   610,   625,   637,   647,   659,
+      695,   699,   735,   771,   791,   827,   847,   867,   903,   939,   959,   979,  1015,  1035,  1071,  1107,
+     1143,  1179,  1215,  1251,  1287,  1323,  1359,  1395,  1431,  1467,  1503,  1539,  1561,  1605,  1627,  1631,
+     1637,  1641,  1669,  1689,  1705,  1725,  1741,  1761,  1781,  1801,  1821,  1845,  1865,  1885,  1913,  1929,
+     1945,  1965,  1985,  2001,  2017,  2037,  2053,  2069,  2097,  2113,  2133,  2149,  2171,  2191,  2213,  2225,
+     2229,  2233,  2237,  2241,  2245,  2253,  2259,  2274,  2289,  2293,  2297,  2301,  2305,  2309,  2313,  2317,
+     2321,  2325,  2329,  2333,  2337,  2341,  2353,  2357,  2361,  2365,  2369,  2373,  2377,  2381,  2385,  2389,
+     2393,  2397,  2401,  2405,  2409,  2413,  2417,  2421,  2425,  2447,  2451,  2487,  2511,  2525,  2529,  2533,
+     2537,  2545,  2560,  2564,  2568,  2572,  2576,  2620,  2625,  2645,  2649,  2653,  2677,  2681,  2685,  2689,
+     2693,  2729,  2765,  2801,  2821,  2859,  2879,  2915,  2951,  2989,  3029,  3065,  3101,  3137,  3173,  3209,
+     3245,  3281,  3301,  3337,  3373,  3409,  3445,  3487,  3523,  3559,  3601,  3637,  3673,  3709,  3745,  3781,
+     3817,  3845,  3865,  3885,  3901,  3921,  3937,  3965,  3981,  3997,  4033,  4049,  4065,  4093,  4109,  4125,
+     4141,  4161,  4177,  4205,  4225,  4265,  4281,  4315,  4331,  4359,  4393,  4421,  4449,  4465,  4481,  4509
+};
+
+// описание шрифта для print_char_font()
+const st7735_font fd_gost_type_a_18_box = { font_gost_type_a_18_box, font_gost_type_a_18_boxidx, 0, 17, 23, 32, 224, BITS_RB, ST7735_FONT_BOX };
+
+#endif // FONT_GOST_TYPE_A_18_BOX_H
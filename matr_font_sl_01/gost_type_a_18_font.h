@@ -8,6 +8,8 @@
 #ifndef FONT_GOST_TYPE_A_18_H
 #define FONT_GOST_TYPE_A_18_H
 
+#include "lcd7735sl.h"
+
 #ifndef FONT_TYPE_MONOSPACED
 #define FONT_TYPE_MONOSPACED                0
 #endif
@@ -264,262 +266,8 @@ const unsigned char  font_gost_type_a_18[FONT_GOST_TYPE_A_18_ARRAY_LENGTH] =
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0xC0, 0x1F, 0x00, 0x80, 0x1B, 0x00, 0xC0, 0x19, 0x00, 0xC0, 0x19, 0x00, 0xC0, 0x18, 0x00, 0xE0, 0x18, 0x00, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00  // Символ 255 <я> 
 };
 
+// описание шрифта для print_char_font()
+const st7735_font fd_gost_type_a_18 = { font_gost_type_a_18, 0, FONT_GOST_TYPE_A_18_CHAR_HEIGHT * 3, FONT_GOST_TYPE_A_18_CHAR_WIDTH, FONT_GOST_TYPE_A_18_CHAR_HEIGHT,
+                                      FONT_GOST_TYPE_A_18_START_CHAR, FONT_GOST_TYPE_A_18_LENGTH, BITS_RB, 0 };
 
-
-const unsigned int font_gost_type_a_18idx[] = {
-0	,
-69	,
-138	,
-207	,
-276	,
-345	,
-414	,
-483	,
-552	,
-621	,
-690	,
-759	,
-828	,
-897	,
-966	,
-1035	,
-1104	,
-1173	,
-1242	,
-1311	,
-1380	,
-1449	,
-1518	,
-1587	,
-1656	,
-1725	,
-1794	,
-1863	,
-1932	,
-2001	,
-2070	,
-2139	,
-2208	,
-2277	,
-2346	,
-2415	,
-2484	,
-2553	,
-2622	,
-2691	,
-2760	,
-2829	,
-2898	,
-2967	,
-3036	,
-3105	,
-3174	,
-3243	,
-3312	,
-3381	,
-3450	,
-3519	,
-3588	,
-3657	,
-3726	,
-3795	,
-3864	,
-3933	,
-4002	,
-4071	,
-4140	,
-4209	,
-4278	,
-4347	,
-4416	,
-4485	,
-4554	,
-4623	,
-4692	,
-4761	,
-4830	,
-4899	,
-4968	,
-5037	,
-5106	,
-5175	,
-5244	,
-5313	,
-5382	,
-5451	,
-5520	,
-5589	,
-5658	,
-5727	,
-5796	,
-5865	,
-5934	,
-6003	,
-6072	,
-6141	,
-6210	,
-6279	,
-6348	,
-6417	,
-6486	,
-6555	,
-6624	,
-6693	,
-6762	,
-6831	,
-6900	,
-6969	,
-7038	,
-7107	,
-7176	,
-7245	,
-7314	,
-7383	,
-7452	,
-7521	,
-7590	,
-7659	,
-7728	,
-7797	,
-7866	,
-7935	,
-8004	,
-8073	,
-8142	,
-8211	,
-8280	,
-8349	,
-8418	,
-8487	,
-8556	,
-8625	,
-8694	,
-8763	,
-8832	,
-8901	,
-8970	,
-9039	,
-9108	,
-9177	,
-9246	,
-9315	,
-9384	,
-9453	,
-9522	,
-9591	,
-9660	,
-9729	,
-9798	,
-9867	,
-9936	,
-10005	,
-10074	,
-10143	,
-10212	,
-10281	,
-10350	,
-10419	,
-10488	,
-10557	,
-10626	,
-10695	,
-10764	,
-10833	,
-10902	,
-10971	,
-11040	,
-11109	,
-11178	,
-11247	,
-11316	,
-11385	,
-11454	,
-11523	,
-11592	,
-11661	,
-11730	,
-11799	,
-11868	,
-11937	,
-12006	,
-12075	,
-12144	,
-12213	,
-12282	,
-12351	,
-12420	,
-12489	,
-12558	,
-12627	,
-12696	,
-12765	,
-12834	,
-12903	,
-12972	,
-13041	,
-13110	,
-13179	,
-13248	,
-13317	,
-13386	,
-13455	,
-13524	,
-13593	,
-13662	,
-13731	,
-13800	,
-13869	,
-13938	,
-14007	,
-14076	,
-14145	,
-14214	,
-14283	,
-14352	,
-14421	,
-14490	,
-14559	,
-14628	,
-14697	,
-14766	,
-14835	,
-14904	,
-14973	,
-15042	,
-15111	,
-15180	,
-15249	,
-15318	,
-15387	,
-15456	,
-15525	,
-15594	,
-15663	,
-15732	,
-15801	,
-15870	,
-15939	,
-16008	,
-16077	,
-16146	,
-16215	,
-16284	,
-16353	,
-16422	,
-16491	,
-16560	,
-16629	,
-16698	,
-16767	,
-16836	,
-16905	,
-16974	,
-17043	,
-17112	,
-17181	,
-17250	,
-17319	,
-17388	,
-17457
-};
 #endif // FONT_GOST_TYPE_A_18_H 
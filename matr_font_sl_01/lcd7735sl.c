@@ -57,6 +57,8 @@
 #define ST77XX_PTLAR      0x30
 #define ST77XX_TEOFF      0x34
 #define ST77XX_TEON       0x35
+#define ST77XX_VSCRDEF    0x33
+#define ST77XX_VSCSAD     0x37
 #define ST77XX_MADCTL     0x36
 #define ST77XX_COLMOD     0x3A
 
@@ -77,52 +79,393 @@ extern void delay_ms(uint32_t ms);
 // ===================================================== //
 // NEW: ================================================ //
 
-// посылка байта команды/данных
-static inline void st7735send(uint8_t dc, uint8_t data)
+#define ST_VALID_CASET    0x01
+#define ST_VALID_RASET    0x02
+#define ST_VALID_MADCTL   0x04
+#define ST_VALID_COLMOD   0x08
+
+// состояние контроллера, известное драйверу: то, что уже установлено, повторно не шлём
+static struct {
+  uint8_t x0, x1;   // текущее окно CASET
+  uint8_t y0, y1;   // текущее окно RASET
+  uint8_t madctl;   // последнее значение MADCTL
+  uint8_t colmod;   // последнее значение COLMOD
+  uint8_t valid;    // какие из полей выше достоверны (ST_VALID_*)
+  uint8_t dc;       // текущий уровень DC
+  uint8_t cs;       // 1 - CS опущен
+  uint8_t wide;     // 1 - SPI в 16-битном режиме
+} lcd;
+
+st7735_stats_t st7735stats;
+
+// шаги неблокирующей инициализации, их выполняет st7735tick()
+#define ST_INIT_IDLE   0
+#define ST_INIT_RESET  1 // RST опущен
+#define ST_INIT_WAKE   2 // RST поднят, ждём готовности контроллера
+#define ST_INIT_TABLE  3 // идём по таблице
+#define ST_INIT_DISPON 4 // ждём после DISPON, затем заливка
+
+static volatile struct {
+  uint8_t        step;   // ST_INIT_*
+  uint8_t        left;   // сколько команд таблицы осталось
+  uint16_t       wait;   // мс до следующего шага
+  const uint8_t *cmd;    // следующая команда таблицы
+  uint8_t        madctl; // ориентация
+  uint8_t        ex, ey; // правый нижний угол экрана для заливки
+  uint16_t       color;  // цвет заливки
+  st7735_cb      done;   // вызывается по окончании заливки
+} lcdinit;
+
+// текущая область прокрутки в строках памяти кадра
+static struct {
+  uint8_t top;   // неподвижная область сверху (TFA)
+  uint8_t lines; // высота прокручиваемой области (VSA)
+  uint8_t vsp;   // строка памяти, которая сейчас показывается первой (VSP)
+} scroll = { 0, ST7735_ROWS, 0 };
+
+// MADCTL для поворотов на 90 градусов по часовой стрелке, начиная с PORTRAIT (0xC0);
+// LANDSCAPE (0x60) - последний. Поворот примитивов отсчитывается от ориентации st7735init
+static const uint8_t st7735rotmadctl[4] = { 0xC0, 0xA0, 0x00, 0x60 };
+static uint8_t rotation = ST7735_ROT0; // текущий поворот, ST7735_ROT*
+
+// стек областей отсечения: [0] - весь экран в текущей ориентации, выше - вложенные области,
+// каждая уже пересечена с предыдущей. Примитивы рисуют только внутри clipstack[clipdepth]
+static st7735_rect clipstack[ST7735_CLIPDEPTH + 1] = { { 0, 0, ST7735_COLS - 1, ST7735_ROWS - 1 } };
+static uint8_t     clipdepth = 0;
+
+// ожидание, пока SPI отправит всё, что лежит в FIFO
+static inline void st7735flush(void)
+{
+  while ((SPI1->SR & SPI_SR_FTLVL) || (SPI1->SR & SPI_SR_BSY)) {};
+}
+
+// DC переключаем только после того, как предыдущие байты ушли целиком
+static inline void st7735dc(uint8_t dc)
 {
+  if (lcd.dc == dc) return;
+  st7735flush();
   if (dc == DATA) DC_UP;
   else            DC_DN;
+  lcd.dc = dc;
+}
+
+// разрядность SPI меняем только на пустом FIFO и только если она действительно другая
+static inline void st7735width(uint8_t wide)
+{
+  if (lcd.wide == wide) return;
+  st7735flush();
+  if (wide) { SPI2SIXTEEN; }
+  else      { SPI2EIGHT; }
+  lcd.wide = wide;
+}
+
+// начало примитива: дожидаемся DMA и опускаем CS, если он ещё не опущен
+static inline void st7735begin(void)
+{
+  while (lcdinit.step != ST_INIT_IDLE) {}; // идёт инициализация - шину держит st7735tick()
+  st7735dmawait();
+  if (!lcd.cs) { CS_DN; lcd.cs = 1; }
+}
 
+// конец примитива: при ST7735_CS_HOLD CS остаётся опущенным до следующего примитива
+static inline void st7735end(void)
+{
+#if !ST7735_CS_HOLD
+  st7735flush();
+  CS_UP;
+  lcd.cs = 0;
+#endif
+}
+
+// посылка байта команды/данных. SPI работает только на передачу, приёмник не читаем
+static inline void st7735send(uint8_t dc, uint8_t data)
+{
+  st7735width(0);
+  st7735dc(dc);
   while (!(SPI1->SR & SPI_SR_TXE));
   SPIDR8BIT = data;
-  while (!(SPI1->SR & SPI_SR_RXNE));
-  uint8_t temp = SPIDR8BIT;
+  st7735stats.sent++;
+}
+
+// посылка 16-битного слова. Команда уходит как 0x00 (NOP) + код команды,
+// поэтому окно и RAMWR идут без переключения SPI обратно на 8 бит
+static inline void st7735send16(uint8_t dc, uint16_t data)
+{
+  st7735width(1);
+  st7735dc(dc);
+  while (!(SPI1->SR & SPI_SR_TXE));
+  SPIDR16BIT = data;
+  st7735stats.sent += 2;
+}
+
+// RAMWR: дальше идут только пиксели, SPI в 16 бит, DC=1
+static inline void st7735ramwr(void)
+{
+  st7735send16(COMM, ST77XX_RAMWR);
+  st7735dc(DATA);
 }
 
 // посылка байта команды/данных
 void send(unsigned char data, unsigned char dc)
 {
-  if (dc == DATA) DC_UP;  //
-  else            DC_DN;  //
+  st7735begin();
+  st7735send(dc, data);
+  st7735end();
+}
 
-  while (!(SPI1->SR & SPI_SR_TXE));
-  SPIDR8BIT = data;
-  while (!(SPI1->SR & SPI_SR_RXNE));
-  uint8_t temp = SPIDR8BIT;
+// поднять CS, например перед работой с другим устройством на шине
+void st7735release(void)
+{
+  st7735dmawait();
+  st7735flush();
+  CS_UP;
+  lcd.cs = 0;
 }
 
+// MADCTL, если значение не изменилось - ничего не шлём
+void st7735madctl(uint8_t value)
+{
+  if ((lcd.valid & ST_VALID_MADCTL) && lcd.madctl == value) { st7735stats.saved += 2; return; }
+  st7735begin();
+  st7735send(COMM, ST77XX_MADCTL);
+  st7735send(DATA, value);
+  st7735end();
+  lcd.madctl = value;
+  lcd.valid |= ST_VALID_MADCTL;
+}
 
-void st7735init(unsigned int orientation, unsigned int color) {
-  CS_DN; // CS=0  - начали сеанс работы с дисплеем
-  // аппаратный сброс дисплея
-  RST_UP; // RST=1
-  delay_ms(ST7735DLY); // пауза
+// поворот системы координат: меняются только MV/MX/MY, то, что уже на экране, остаётся.
+// Строки матриц идут в повёрнутое окно как есть - повёрнутый текст стоит столько же, сколько обычный
+// точка (x, y) при MADCTL from -> та же точка экрана при MADCTL to. Через адрес в памяти кадра:
+// MV меняет оси местами, затем MX/MY разворачивают столбцы/строки памяти
+static void st7735remap(uint8_t from, uint8_t to, int16_t *x, int16_t *y)
+{
+  int16_t c = (from & ST77XX_MADCTL_MV) ? *y : *x;
+  int16_t r = (from & ST77XX_MADCTL_MV) ? *x : *y;
+  if ((from ^ to) & ST77XX_MADCTL_MX) c = ST7735_COLS - 1 - c;
+  if ((from ^ to) & ST77XX_MADCTL_MY) r = ST7735_ROWS - 1 - r;
+  *x = (to & ST77XX_MADCTL_MV) ? r : c;
+  *y = (to & ST77XX_MADCTL_MV) ? c : r;
+}
+
+uint8_t st7735rotate(uint8_t rot)
+{
+  uint8_t old = rotation, base = 0, from = lcd.madctl, i;
+  st7735_rect *n;
+  const st7735_rect *c;
+  int16_t t;
+  while (base < 3 && st7735rotmadctl[base] != lcdinit.madctl) base++;
+  rotation = rot & 3;
+  st7735madctl(st7735rotmadctl[(base + rotation) & 3]); // то же значение повторно не шлётся
+  // при MV=1 длинная сторона идёт по X
+  clipstack[0].x1 = (lcd.madctl & ST77XX_MADCTL_MV) ? ST7735_ROWS - 1 : ST7735_COLS - 1;
+  clipstack[0].y1 = (lcd.madctl & ST77XX_MADCTL_MV) ? ST7735_COLS - 1 : ST7735_ROWS - 1;
+  // открытые области отсечения - те же места экрана в новых координатах, вложенные друг в друга
+  for (i = 1; i <= clipdepth && from != lcd.madctl; i++) {
+    n = &clipstack[i];
+    c = &clipstack[i - 1];
+    if (n->x0 > n->x1 || n->y0 > n->y1) { n->x0 = n->y0 = 0; n->x1 = n->y1 = -1; continue; } // пустая
+    st7735remap(from, lcd.madctl, &n->x0, &n->y0);
+    st7735remap(from, lcd.madctl, &n->x1, &n->y1);
+    if (n->x0 > n->x1) { t = n->x0; n->x0 = n->x1; n->x1 = t; }
+    if (n->y0 > n->y1) { t = n->y0; n->y0 = n->y1; n->y1 = t; }
+    if (n->x0 < c->x0) n->x0 = c->x0;
+    if (n->y0 < c->y0) n->y0 = c->y0;
+    if (n->x1 > c->x1) n->x1 = c->x1;
+    if (n->y1 > c->y1) n->y1 = c->y1;
+  }
+  return old;
+}
 
-  st7735send(COMM,ST77XX_SWRESET);
-  delay_ms(ST7735DLY);
+// COLMOD, если значение не изменилось - ничего не шлём
+void st7735colmod(uint8_t value)
+{
+  if ((lcd.valid & ST_VALID_COLMOD) && lcd.colmod == value) { st7735stats.saved += 2; return; }
+  st7735begin();
+  st7735send(COMM, ST77XX_COLMOD);
+  st7735send(DATA, value);
+  st7735end();
+  lcd.colmod = value;
+  lcd.valid |= ST_VALID_COLMOD;
+}
 
-  st7735send(COMM, 0x11); // SLPOUT (0x11) после сброса дисплей спит - даем команду проснуться  // SLPIN (10h) / SLPOUT (11h)
-  delay_ms(ST7735DLY);
 
-  st7735send(COMM, 0x3A); // COLMOD (0x3A) режим цвета:
-  st7735send(DATA, 0x05); // 16 бит
-  
-  // MADCTL (36h) – установка режима адресации и, соответственно, порядка вывода данных на дисплей, эта команда определяет ориентацию изображения на экране,
-  // кроме того, бит RGB параметра этой команды ответственен за распределение интенсивности между субпикселями (красным, зелёным и синим)
-  st7735send(COMM, 0x36); // MADCTL (0x36) направление вывода изображения:
-  if (orientation ==  PORTRAIT)  st7735send(DATA, 0xC0);
-  if (orientation == LANDSCAPE)  st7735send(DATA, 0x60);
+// ===================================================== //
+// DMA: ================================================ //
+// SPI1_TX на STM32F031 обслуживается каналом 3 DMA1
+
+#define ST7735_DMA        DMA1_Channel3
+#define ST7735_DMA_CHUNK  0xFFFF // больше CNDTR за один раз не примет
+
+static volatile uint8_t  dma_busy  = 0; // 1 - идёт передача, SPI трогать нельзя
+static volatile uint8_t  dma_close = 0; // 1 - по окончании передачи закрыть сеанс
+static volatile uint32_t dma_left  = 0; // сколько пикселей заливки осталось после текущего куска
+static volatile uint16_t dma_color;     // источник для заливки, инкремент памяти выключен
+static st7735_cb         dma_done  = 0; // вызывается по окончании заливки
 
+// строки символа для вывода через DMA: пока одна уходит в SPI, во вторую раскладываем следующую
+static uint16_t linebuf[2][ST7735_LINEBUF];
+
+#define ST7735_LUT 64 // слов в таблице цветов символа: 16 полубайтов по 4 точки
+
+static void st7735dmainit(void)
+{
+  RCC->AHBENR |= RCC_AHBENR_DMAEN;
+  ST7735_DMA->CCR  = 0;
+  ST7735_DMA->CPAR = (uint32_t)&SPI1->DR;
+  SPI1->CR2 |= SPI_CR2_TXDMAEN; // запросы идут только при включенном канале
+  NVIC_SetPriority(DMA1_Channel2_3_IRQn, 1);
+  NVIC_EnableIRQ(DMA1_Channel2_3_IRQn);
+}
+
+// запуск передачи count 16-битных слов, minc - DMA_CCR_MINC или 0
+static void st7735dmastart(const volatile void *src, uint16_t count, uint32_t minc)
+{
+  ST7735_DMA->CCR   = 0;
+  ST7735_DMA->CMAR  = (uint32_t)src;
+  ST7735_DMA->CNDTR = count;
+  ST7735_DMA->CCR   = DMA_CCR_DIR | DMA_CCR_PSIZE_0 | DMA_CCR_MSIZE_0 | DMA_CCR_TCIE | minc | DMA_CCR_EN;
+}
+
+// окончание сеанса вывода через DMA
+static void st7735dmaclose(void)
+{
+  // DMA только переложил последние слова в FIFO - дожидаемся, пока SPI их отправит
+  st7735flush();
+  st7735end();
+}
+
+void DMA1_Channel2_3_IRQHandler(void)
+{
+  uint16_t n;
+  if (!(DMA1->ISR & DMA_ISR_TCIF3)) return;
+  DMA1->IFCR = DMA_IFCR_CGIF3;
+  ST7735_DMA->CCR = 0;
+
+  if (dma_left) { // заливка больше 65535 пикселей - запускаем следующий кусок
+    n = (dma_left > ST7735_DMA_CHUNK) ? ST7735_DMA_CHUNK : dma_left;
+    dma_left -= n;
+    st7735dmastart(&dma_color, n, 0);
+    return;
+  }
+  if (dma_close) st7735dmaclose();
+  dma_busy = 0;
+  if (dma_close && dma_done) dma_done();
+}
+
+uint8_t st7735dmabusy(void)
+{
+  return dma_busy;
+}
+
+void st7735dmawait(void)
+{
+  while (dma_busy) {};
+}
+
+// ===================================================== //
+// INIT: =============================================== //
+// инициализация идёт по таблице и не блокирует main: паузы между командами отсчитывает
+// st7735tick() из SysTick, остальное время контроллер свободен для другой работы.
+// Формат таблицы: число команд, затем для каждой - код, число параметров (| ST_CMD_DELAY,
+// если после параметров идёт пауза в мс), параметры, [пауза]
+
+static const uint8_t st7735initcmds[] = {
+  17,
+  ST77XX_SWRESET,  ST_CMD_DELAY, ST7735DLY,
+  ST77XX_SLPOUT,   ST_CMD_DELAY, ST7735DLY, // после сброса дисплей спит - даем команду проснуться
+  ST77XX_COLMOD,   1, 0x05,                 // режим цвета: 16 бит
+  ST7735_FRMCTR1,  3, 0x01, 0x2C, 0x2D,
+  ST7735_FRMCTR2,  3, 0x01, 0x2C, 0x2D,
+  ST7735_FRMCTR3,  6, 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D,
+  ST7735_INVCTR,   1, 0x07,
+  ST7735_PWCTR1,   3, 0xA2, 0x02, 0x84,
+  ST7735_PWCTR2,   1, 0xC5,
+  ST7735_PWCTR3,   2, 0x0A, 0x00,
+  ST7735_PWCTR4,   2, 0x8A, 0x2A,
+  ST7735_PWCTR5,   2, 0x8A, 0xEE,
+  ST7735_VMCTR1,   1, 0x0E,
+  ST77XX_INVOFF,   0,                       // INVOFF (20h) / INVON (21h) – выключение/включение инверсии дисплея
+  ST7735_GMCTRP1, 16, 0x02, 0x1C, 0x07, 0x12, 0x37, 0x32, 0x29, 0x2D,
+                      0x29, 0x25, 0x2B, 0x39, 0x00, 0x01, 0x03, 0x10,
+  ST7735_GMCTRN1, 16, 0x03, 0x1D, 0x07, 0x06, 0x2E, 0x2C, 0x29, 0x2D,
+                      0x2E, 0x2E, 0x37, 0x3F, 0x00, 0x00, 0x02, 0x10,
+  ST77XX_NORON,    ST_CMD_DELAY, ST7735DLY,
+};
+// DISPON не в таблице: его шлём уже после MADCTL, чтобы не показывать экран в чужой ориентации
+
+// очередной шаг инициализации: шлём команды до первой паузы
+static void st7735initstep(void)
+{
+  uint8_t n, i;
+  switch (lcdinit.step) {
+  case ST_INIT_RESET:
+    RST_UP;
+    lcdinit.wait = ST7735DLY;
+    lcdinit.step = ST_INIT_WAKE;
+    break;
+  case ST_INIT_WAKE:
+    lcdinit.cmd  = st7735initcmds + 1;
+    lcdinit.left = st7735initcmds[0];
+    lcdinit.step = ST_INIT_TABLE;
+    // no break
+  case ST_INIT_TABLE:
+    while (lcdinit.left) {
+      lcdinit.left--;
+      st7735send(COMM, *lcdinit.cmd++);
+      n = *lcdinit.cmd++;
+      for (i = 0; i < (n & ~ST_CMD_DELAY); i++) st7735send(DATA, *lcdinit.cmd++);
+      if (n & ST_CMD_DELAY) {
+        st7735flush();
+        lcdinit.wait = *lcdinit.cmd++;
+        return;
+      }
+    }
+    lcd.colmod = 0x05;
+    lcd.valid |= ST_VALID_COLMOD;
+    st7735send(COMM, ST77XX_MADCTL);
+    st7735send(DATA, lcdinit.madctl);
+    lcd.madctl = lcdinit.madctl;
+    lcd.valid |= ST_VALID_MADCTL;
+    st7735send(COMM, ST77XX_DISPON);
+    st7735flush();
+    lcdinit.wait = ST7735DLY;
+    lcdinit.step = ST_INIT_DISPON;
+    break;
+  case ST_INIT_DISPON:
+    st7735end();
+    lcdinit.step = ST_INIT_IDLE; // дальше обычные примитивы, st7735begin() больше не ждёт
+    // очистка экрана идёт по DMA в фоне, первый же следующий примитив дождётся её окончания
+    st7735fillrect_dma(0, 0, lcdinit.ex, lcdinit.ey, lcdinit.color, lcdinit.done);
+    break;
+  }
+}
+
+// вызывается из SysTick_Handler раз в 1 мс
+void st7735tick(void)
+{
+  if (lcdinit.step == ST_INIT_IDLE) return;
+  if (lcdinit.wait && --lcdinit.wait) return;
+  st7735initstep();
+}
+
+uint8_t st7735initbusy(void)
+{
+  return lcdinit.step != ST_INIT_IDLE;
+}
+
+void st7735init_start(unsigned int orientation, unsigned int color, st7735_cb done)
+{
+  st7735dmawait();
+  while (lcdinit.step != ST_INIT_IDLE) {};
+  st7735dmainit();
+  lcd.valid = 0;    // после сброса контроллер ничего не помнит
+  lcd.dc    = 0xFF; // уровень DC неизвестен - первая же посылка его выставит
+  scroll.top = 0; scroll.lines = ST7735_ROWS; scroll.vsp = 0;
+  rotation  = ST7735_ROT0;
+  clipdepth = 0;
+  CS_DN; lcd.cs = 1; // начали сеанс работы с дисплеем
+  // MADCTL (36h) - порядок вывода данных на дисплей, т.е. ориентация изображения
   // 00 = upper left printing right
   // 10 = does nothing (MADCTL_ML)
   // 20 = upper left printing down (backwards) (Vertical flip)
@@ -132,344 +475,1341 @@ void st7735init(unsigned int orientation, unsigned int color) {
   // 60 = 90 right rotation
   // C0 = 180 right rotation
   // A0 = 270 right rotation
+  if (orientation == LANDSCAPE) { lcdinit.madctl = st7735rotmadctl[3]; lcdinit.ex = 159; lcdinit.ey = 127; }
+  else                          { lcdinit.madctl = st7735rotmadctl[0]; lcdinit.ex = 127; lcdinit.ey = 159; }
+  clipstack[0].x1 = lcdinit.ex;
+  clipstack[0].y1 = lcdinit.ey;
+  lcdinit.color = color;
+  lcdinit.done  = done;
+  // аппаратный сброс дисплея
+  RST_DN;
+  lcdinit.wait = ST7735DLY;
+  lcdinit.step = ST_INIT_RESET; // с этого момента шаги выполняет st7735tick()
+}
 
-  st7735send(COMM, ST7735_FRMCTR1);
-  st7735send(DATA, 0x01);
-  st7735send(DATA, 0x2C);
-  st7735send(DATA, 0x2D);
-
-  st7735send(COMM, ST7735_FRMCTR2);
-  st7735send(DATA, 0x01);
-  st7735send(DATA, 0x2C);
-  st7735send(DATA, 0x2D);
-
-  st7735send(COMM, ST7735_FRMCTR3);
-  st7735send(DATA, 0x01);
-  st7735send(DATA, 0x2C);
-  st7735send(DATA, 0x2D);
-  st7735send(DATA, 0x01);
-  st7735send(DATA, 0x2C);
-  st7735send(DATA, 0x2D);
-
-  st7735send(COMM, ST7735_INVCTR);
-  st7735send(DATA, 0x07);
-
-  st7735send(COMM, ST7735_PWCTR1);
-  st7735send(DATA, 0xA2);
-  st7735send(DATA, 0x02);
-  st7735send(DATA, 0x84);
-
-  st7735send(COMM, ST7735_PWCTR2);
-  st7735send(DATA, 0xC5);
-
-  st7735send(COMM, ST7735_PWCTR3);
-  st7735send(DATA, 0x0A);
-  st7735send(DATA, 0x00);
-
-  st7735send(COMM, ST7735_PWCTR4);
-  st7735send(DATA, 0x8A);
-  st7735send(DATA, 0x2A);
-
-  st7735send(COMM, ST7735_PWCTR5);
-  st7735send(DATA, 0x8A);
-  st7735send(DATA, 0xEE);
-
-  st7735send(COMM, ST7735_VMCTR1);
-  st7735send(DATA, 0x0E);
-
-  st7735send(COMM, ST77XX_INVOFF);  // INVOFF (20h) / INVON (21h) – выключение/включение инверсии дисплея. 
-
-  st7735send(COMM, ST7735_GMCTRP1);
-  st7735send(DATA, 0x02);
-  st7735send(DATA, 0x1C);
-  st7735send(DATA, 0x07);
-  st7735send(DATA, 0x12);
-  st7735send(DATA, 0x37);
-  st7735send(DATA, 0x32);
-  st7735send(DATA, 0x29);
-  st7735send(DATA, 0x2D);
-  st7735send(DATA, 0x29);
-  st7735send(DATA, 0x25);
-  st7735send(DATA, 0x2B);
-  st7735send(DATA, 0x39);
-  st7735send(DATA, 0x00);
-  st7735send(DATA, 0x01);
-  st7735send(DATA, 0x03);
-  st7735send(DATA, 0x10);
-
-  st7735send(COMM, ST7735_GMCTRN1);
-  st7735send(DATA, 0x03);
-  st7735send(DATA, 0x1D);
-  st7735send(DATA, 0x07);
-  st7735send(DATA, 0x06);
-  st7735send(DATA, 0x2E);
-  st7735send(DATA, 0x2C);
-  st7735send(DATA, 0x29);
-  st7735send(DATA, 0x2D);
-  st7735send(DATA, 0x2E);
-  st7735send(DATA, 0x2E);
-  st7735send(DATA, 0x37);
-  st7735send(DATA, 0x3F);
-  st7735send(DATA, 0x00);
-  st7735send(DATA, 0x00);
-  st7735send(DATA, 0x02);
-  st7735send(DATA, 0x10);
-  
-  st7735send(COMM, ST77XX_NORON);
-  delay_ms(ST7735DLY);
+void st7735init(unsigned int orientation, unsigned int color)
+{
+  st7735init_start(orientation, color, 0);
+  while (lcdinit.step != ST_INIT_IDLE) {};
+}
+
+// ===================================================== //
+// CLIP: =============================================== //
+// все примитивы рисуют только внутри текущей области отсечения: окно обрезается до того,
+// как уйдёт первый байт, целиком невидимый примитив не шлёт ничего
 
-  st7735send(COMM, ST77XX_DISPON);
-  delay_ms(ST7735DLY);
+uint8_t st7735clip_push(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  const st7735_rect *c = &clipstack[clipdepth];
+  st7735_rect *n;
+  if (clipdepth == ST7735_CLIPDEPTH) return 0;
+  n = &clipstack[++clipdepth];
+  n->x0 = (x0 > c->x0) ? x0 : c->x0;
+  n->y0 = (y0 > c->y0) ? y0 : c->y0;
+  n->x1 = (x1 < c->x1) ? x1 : c->x1;
+  n->y1 = (y1 < c->y1) ? y1 : c->y1;
+  return 1;
+}
 
-  CS_DN; // chip_select_disable();
+void st7735clip_pop(void)
+{
+  if (clipdepth) clipdepth--;
+}
 
-  if (orientation ==  PORTRAIT) st7735fillrect(0, 0, 127, 159, color);
-  if (orientation == LANDSCAPE) st7735fillrect(0, 0, 159, 127, color);
+const st7735_rect *st7735clip_get(void)
+{
+  return &clipstack[clipdepth];
+}
+
+// видимая часть прямоугольника x0..x1, y0..y1 (может выходить за экран и за байт):
+// 0 - не видно ничего, иначе в v - то, что нужно вывести
+static uint8_t st7735clip(int16_t x0, int16_t y0, int16_t x1, int16_t y1, st7735_rect *v)
+{
+  const st7735_rect *c = &clipstack[clipdepth];
+  v->x0 = (x0 > c->x0) ? x0 : c->x0;
+  v->y0 = (y0 > c->y0) ? y0 : c->y0;
+  v->x1 = (x1 < c->x1) ? x1 : c->x1;
+  v->y1 = (y1 < c->y1) ? y1 : c->y1;
+  if (v->x0 <= v->x1 && v->y0 <= v->y1) return 1;
+  st7735stats.clipped++;
+  return 0;
+}
+
+// 1 - прямоугольник виден целиком, рисуется обычным путём
+static inline uint8_t st7735whole(const st7735_rect *v, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  return v->x0 == x0 && v->y0 == y0 && v->x1 == x1 && v->y1 == y1;
 }
 
 // определение области экрана для заполнения
+// CASET/RASET шлются 16-битными словами (старший байт координаты 0x00) и только если
+// диапазон отличается от уже установленного: RAMWR всё равно начинает с левого верхнего угла окна
 void st7735setwin(unsigned char startX, unsigned char startY, unsigned char stopX, unsigned char stopY)
 {
-  st7735send(COMM, 0x2A); // CASET
-  DC_UP;
-  st7735send(DATA, 0x00); // MADCTL_RGB // 00 = upper left printing right
-  st7735send(DATA, startX);
-  st7735send(DATA, 0x00);
-  st7735send(DATA, stopX);
-
-  st7735send(COMM, 0x2B); // RASET
-  DC_UP;
-  st7735send(DATA, 0x00);
-  st7735send(DATA, startY);
-  st7735send(DATA, 0x00);
-  st7735send(DATA, stopY);
+  if (!(lcd.valid & ST_VALID_CASET) || lcd.x0 != startX || lcd.x1 != stopX) {
+    st7735send16(COMM, ST77XX_CASET);
+    st7735send16(DATA, startX);
+    st7735send16(DATA, stopX);
+    lcd.x0 = startX;
+    lcd.x1 = stopX;
+    lcd.valid |= ST_VALID_CASET;
+  } else st7735stats.saved += 6;
+
+  if (!(lcd.valid & ST_VALID_RASET) || lcd.y0 != startY || lcd.y1 != stopY) {
+    st7735send16(COMM, ST77XX_RASET);
+    st7735send16(DATA, startY);
+    st7735send16(DATA, stopY);
+    lcd.y0 = startY;
+    lcd.y1 = stopY;
+    lcd.valid |= ST_VALID_RASET;
+  } else st7735stats.saved += 6;
 }
 
 // вывод пиксела
-void st7735pixel(unsigned char X, unsigned char Y, unsigned int color)
+void st7735pixel(int16_t X, int16_t Y, unsigned int color)
 {
-  CS_DN;
+  st7735_rect v;
+  if (!st7735clip(X, Y, X, Y, &v)) return;
+  st7735begin();
   st7735setwin(X, Y, X, Y);
-  st7735send(COMM, 0x2C); // RAMWR
-  st7735send(DATA, (unsigned char)((color & 0xFF00)>>8));
-  st7735send(DATA, (unsigned char) (color & 0x00FF));
-  CS_UP;
+  st7735ramwr();
+  while (!(SPI1->SR & SPI_SR_TXE));
+  SPIDR16BIT = color;
+  st7735stats.sent += 2;
+  st7735end();
 }
 
 // процедура заполнения прямоугольной области экрана заданным цветом
-void st7735fillrect(unsigned char startX, unsigned char startY, unsigned char stopX, unsigned char stopY, unsigned int color)
+void st7735fillrect(int16_t startX, int16_t startY, int16_t stopX, int16_t stopY, unsigned int color)
 {
-  unsigned char X;
-  unsigned char Y;
-  CS_DN;
-  st7735setwin(startX, startY, stopX, stopY);
-  st7735send(COMM, 0x2C); // RAMWR
-  DC_UP;
-  SPI2SIXTEEN;
-
-  for (Y = startY; Y < stopY + 1; Y++)
-    for (X = startX; X < stopX + 1; X++) 
+  uint32_t count;
+  st7735_rect v;
+  if (!st7735clip(startX, startY, stopX, stopY, &v)) return;
+  count = (uint32_t)(v.x1 - v.x0 + 1) * (v.y1 - v.y0 + 1);
+  st7735begin();
+  st7735setwin(v.x0, v.y0, v.x1, v.y1);
+  st7735ramwr();
+
+  st7735stats.sent += 2 * count;
+  while (count--)
     {
       while (!(SPI1->SR & SPI_SR_TXE));
-      SPI1->DR = color;
+      SPIDR16BIT = color;
     }
-  while (!(SPI1->SR & SPI_SR_TXE) || (SPI1->SR & SPI_SR_BSY));
+  st7735end();
+}
 
-  SPI2EIGHT;
-  CS_UP;
+// заливка прямоугольника через DMA: канал шлёт одно и то же слово цвета без инкремента памяти,
+// процессор свободен, пока дисплей заливается
+void st7735fillrect_dma(int16_t startX, int16_t startY, int16_t stopX, int16_t stopY, unsigned int color, st7735_cb done)
+{
+  uint32_t count;
+  uint16_t n;
+  st7735_rect v;
+  if (!st7735clip(startX, startY, stopX, stopY, &v)) { // заливать нечего - заливка "уже кончилась"
+    if (done) done();
+    return;
+  }
+  count = (uint32_t)(v.x1 - v.x0 + 1) * (v.y1 - v.y0 + 1);
+  st7735begin();
+  st7735setwin(v.x0, v.y0, v.x1, v.y1);
+  st7735ramwr();
+  st7735stats.sent += 2 * count;
+
+  n = (count > ST7735_DMA_CHUNK) ? ST7735_DMA_CHUNK : count;
+  dma_color = color;
+  dma_left  = count - n;
+  dma_done  = done;
+  dma_close = 1;
+  dma_busy  = 1;
+  st7735dmastart(&dma_color, n, 0);
 }
 
-// процедура рисования линии
-void st7735line(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned int color) {
-  signed char   dx, dy, sx, sy;
-  unsigned char  x,  y, mdx, mdy, l;
+// заливка через DMA с ожиданием окончания
+void st7735fillrect_dmawait(int16_t startX, int16_t startY, int16_t stopX, int16_t stopY, unsigned int color)
+{
+  st7735fillrect_dma(startX, startY, stopX, stopY, color, 0);
+  st7735dmawait();
+}
+
+// ===================================================== //
+// SCROLL: ============================================= //
+// аппаратная вертикальная прокрутка: контроллер сдвигает строки памяти кадра
+// (длинная сторона, 160 строк), поэтому в LANDSCAPE (MV=1) она идёт вдоль X
+
+void st7735scrolldef(unsigned char top, unsigned char bottom)
+{
+  // прокручиваемой области остаётся хотя бы строка
+  if (top >= ST7735_ROWS)         top    = ST7735_ROWS - 1;
+  if (bottom >= ST7735_ROWS - top) bottom = ST7735_ROWS - top - 1;
+  scroll.top   = top;
+  scroll.lines = ST7735_ROWS - top - bottom;
+  st7735begin();
+  st7735send16(COMM, ST77XX_VSCRDEF);
+  st7735send16(DATA, top);
+  st7735send16(DATA, scroll.lines);
+  st7735send16(DATA, bottom);
+  st7735end();
+  st7735scrollto(top);
+}
+
+void st7735scrollto(unsigned char row)
+{
+  scroll.vsp = row;
+  st7735begin();
+  st7735send16(COMM, ST77XX_VSCSAD);
+  st7735send16(DATA, row);
+  st7735end();
+}
+
+// новая строка журнала: самая старая строка области (она вверху) заливается фоном
+// и прокруткой уезжает вниз. Возвращает координату, с которой в ней можно рисовать
+unsigned char st7735scrollline(unsigned char height, unsigned int color)
+{
+  uint8_t row = scroll.vsp, pos, next;
+  // строка должна целиком лечь в область, а область - делиться на строки
+  if (!height || scroll.lines % height || row < scroll.top || row + height > scroll.top + scroll.lines)
+    return ST7735_NOSCROLL;
+  next = row + height;
+  if (next >= scroll.top + scroll.lines) next -= scroll.lines;
+  // строки памяти идут в обратную сторону при MY=1
+  pos = (lcd.madctl & ST77XX_MADCTL_MY) ? ST7735_ROWS - row - height : row;
+  if (lcd.madctl & ST77XX_MADCTL_MV) st7735fillrect_dma(pos, 0, pos + height - 1, ST7735_COLS - 1, color, 0);
+  else                               st7735fillrect_dma(0, pos, ST7735_COLS - 1, pos + height - 1, color, 0);
+  st7735scrollto(next); // дождётся окончания заливки
+  return pos;
+}
+
+// горизонтальный отрезок одной заливкой, концы в любом порядке
+void st7735hline(int16_t x1, int16_t x2, int16_t y, unsigned int color)
+{
+  if (x1 > x2) st7735fillrect(x2, y, x1, y, color);
+  else         st7735fillrect(x1, y, x2, y, color);
+}
+
+// вертикальный отрезок одной заливкой, концы в любом порядке
+void st7735vline(int16_t x, int16_t y1, int16_t y2, unsigned int color)
+{
+  if (y1 > y2) st7735fillrect(x, y2, x, y1, color);
+  else         st7735fillrect(x, y1, x, y2, color);
+}
+
+// процедура рисования линии: Брезенхем без деления, точки собираются в горизонтальные
+// (пологая линия) или вертикальные (крутая) отрезки, каждый отрезок - одно окно
+void st7735line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, unsigned int color) {
+  int16_t mdx, mdy, sx, sy, err;
+  int16_t x = x1, y = y1, start;
 
   if (x1==x2) { // быстрая отрисовка вертикальной линии
-    st7735fillrect(x1,y1, x1,y2, color);
+    st7735vline(x1, y1, y2, color);
     return;
   }
   if (y1==y2) { // быстрая отрисовка горизонтальной линии
-    st7735fillrect(x1,y1, x2,y1, color);
+    st7735hline(x1, x2, y1, color);
     return;
   }
-  dx=x2-x1; dy=y2-y1;
-  if (dx>=0) { mdx=dx; sx=1; } else { mdx=x1-x2; sx=-1; }
-  if (dy>=0) { mdy=dy; sy=1; } else { mdy=y1-y2; sy=-1; }
-  x=x1; y=y1;
-  if (mdx>=mdy) {
-    l=mdx;
-    while (l>0) {
-      if (dy>0) { y=y1+mdy*(x-x1)/mdx; }
-      else      { y=y1-mdy*(x-x1)/mdx; }
-      st7735pixel(x,y,color);
-      x=x+sx;
-      l--;
+  if (x2 >= x1) { mdx = x2 - x1; sx = 1; } else { mdx = x1 - x2; sx = -1; }
+  if (y2 >= y1) { mdy = y2 - y1; sy = 1; } else { mdy = y1 - y2; sy = -1; }
+
+  if (mdx >= mdy) { // пологая: шагаем по x, отрезок заканчивается, когда меняется y
+    err = mdx >> 1;
+    start = x;
+    for (;;) {
+      if (x == x2) { st7735hline(start, x, y, color); break; }
+      err -= mdy;
+      if (err < 0) {
+        st7735hline(start, x, y, color);
+        y += sy;
+        err += mdx;
+        start = x + sx;
+      }
+      x += sx;
     }
-  } else {
-    l=mdy;
-    while (l>0) {
-      if (dy>0) { x=x1+((mdx*(y-y1))/mdy); }
-      else      { x=x1+((mdx*(y1-y))/mdy); }
-      st7735pixel(x,y,color);
-      y=y+sy;
-      l--;
+  } else {          // крутая: шагаем по y, отрезок заканчивается, когда меняется x
+    err = mdy >> 1;
+    start = y;
+    for (;;) {
+      if (y == y2) { st7735vline(x, start, y, color); break; }
+      err -= mdx;
+      if (err < 0) {
+        st7735vline(x, start, y, color);
+        x += sx;
+        err += mdy;
+        start = y + sy;
+      }
+      y += sy;
     }
   }
-  st7735pixel(x2, y2, color);
-}
-
-// forward bits
-void print_char_sl_fb(unsigned char CH,            // символ который выводим
-                unsigned char X, unsigned char Y, // координаты
-                unsigned char SymbolWidth,        // ширина символа
-                unsigned char SymbolHeight,       // высота символа
-                unsigned char MatrixLength,       // длина матрицы символа
-                const unsigned char font[],       // шрифт
-                const unsigned int index[],       // индексный массив шрифта
-                unsigned int fcolor,              // цвет шрифта
-                unsigned int bcolor)              // цвет фона
-{
-  unsigned char MatrixByte;   // временная для обработки байта матрицы
-  unsigned char BitMask;      // маска, накладываемая на байт для получения значения одного бита
-  unsigned char BitWidth;     // счётчик выведенных по горизонтали точек
-  const unsigned char *MatrixPointer = font;
-  unsigned char color;
-  BitWidth = SymbolWidth;     // начальная установка счётчика
-  MatrixPointer += index[CH]; // перемещаем указатель на начало символа CH
-  
-  // начало алгоритма вывода. Вывод без поворота
-  // x матрицы = x символа (ширина)
-  // y матрицы = y символа (высота)
-  CS_DN;
-  st7735setwin(X, Y, X + SymbolWidth - 1, Y - SymbolHeight - 1); // Ширина и высота шрифта от 0
-  st7735send(COMM, 0x2C); // Команда RAMWR (0x2C) указывает контроллеру дисплея, что все данные, идущие после неё, нужно воспринимать, 
-                          // как байты кодировки цвета (не забываем про 2 байта на цвет одного пикселя), которые после преобразования выводятся 
-                          // поочерёдно в соответствующем месте области вывода.
-  SPI2SIXTEEN; // SPI в 16 бит
-  DC_UP;
-  
-  do {
-    MatrixByte    = *MatrixPointer;     // чтение очередного байта матрицы
-    
-    MatrixPointer =  MatrixPointer + 1; // после чтения передвинем указатель на следующий байт матрицы
-    MatrixLength  =  MatrixLength  - 1; // можно писать просто MatrixLength--; но мне так не нравится...
-    BitMask       =  0b10000000;        // предустановка маски и ширины символа на начало для каждого прочитанного байта
-    do {
-      while (!(SPI1->SR & SPI_SR_TXE)) {}; // ждём TXE перед отправкой (проверка есть ли данные в SPI)
-      if ((MatrixByte & BitMask) > 0) SPI1->DR = fcolor; // вывод в поток точки цвета символа
-      else                            SPI1->DR = bcolor; // вывод в поток точки цвета фона
-      BitMask  = BitMask >> 1; // как только бит выедет вправо, BitMask станет равен 0. Значит, вывели все 8 битов в поток
-      BitWidth = BitWidth - 1; // как только значение станет равным 0. Значит, все биты строки вывели в поток
-    } while ((BitWidth > 0) && (BitMask > 0)); // если хоть что-то стало 0, надо читать следующий байт - выходим из этого цикла
-    if (BitWidth == 0) BitWidth = SymbolWidth; // если выход был по окончании вывода строки - снова предустановим счётчик
-                                               // один раз на символ предустановка лишняя, но организовывать проверку
-                                               // окажется много дороже, чем один лишний раз присвоить значение
-  } while (MatrixLength > 0);
-  // закончили
-  while (!(SPI1->SR & SPI_SR_TXE) || (SPI1->SR & SPI_SR_BSY)) {};
-  CS_UP;
-  SPI2EIGHT;
-}
-
-// reverse bits
-void print_char_sl_rb(unsigned char CH,            // символ который выводим
-                unsigned char X, unsigned char Y, // координаты
-                unsigned char SymbolWidth,        // ширина символа
-                unsigned char SymbolHeight,       // высота символа
-                unsigned char MatrixLength,       // длина матрицы символа
-                const unsigned char font[],       // шрифт
-                const unsigned int index[],       // индексный массив шрифта
-                unsigned int fcolor,              // цвет шрифта
-                unsigned int bcolor)              // цвет фона
-{
-  unsigned char MatrixByte;   // временная для обработки байта матрицы
-  unsigned char BitMask;      // маска, накладываемая на байт для получения значения одного бита
-  unsigned char BitWidth;     // счётчик выведенных по горизонтали точек
-  const unsigned char *MatrixPointer = font;
-  unsigned char color;
-  BitWidth = SymbolWidth;     // начальная установка счётчика
-  MatrixPointer += index[CH]; // перемещаем указатель на начало символа CH
-  
-  // начало алгоритма вывода. Вывод без поворота
-  // x матрицы = x символа (ширина)
-  // y матрицы = y символа (высота)
-  CS_DN;
-  st7735setwin(X, Y, X + SymbolWidth - 1, Y - SymbolHeight - 1); // Ширина и высота шрифта от 0
-  st7735send(COMM, 0x2C); // Команда RAMWR (0x2C) указывает контроллеру дисплея, что все данные, идущие после неё, нужно воспринимать, 
-                          // как байты кодировки цвета (не забываем про 2 байта на цвет одного пикселя), которые после преобразования выводятся 
-                          // поочерёдно в соответствующем месте области вывода.
-  SPI2SIXTEEN; // SPI в 16 бит
-  DC_UP;
-  
+}
+
+// рисование прямоугольника (не заполненного)
+void st7735rect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, unsigned int color)
+{
+  if (y1 == y2) { st7735hline(x1, x2, y1, color); return; } // вырожденный - одна линия
+  if (x1 == x2) { st7735vline(x1, y1, y2, color); return; }
+  st7735hline(x1, x2, y1, color);
+  st7735hline(x1, x2, y2, color);
+  if (y2 > y1 + 1) st7735vline(x1, y1 + 1, y2 - 1, color);
+  if (y1 > y2 + 1) st7735vline(x1, y2 + 1, y1 - 1, color);
+  if (y2 > y1 + 1) st7735vline(x2, y1 + 1, y2 - 1, color);
+  if (y1 > y2 + 1) st7735vline(x2, y2 + 1, y1 - 1, color);
+}
+
+// отрезки контура скругления для точек (xa..xb, y) первого октанта. Центры скруглений:
+// cx0/cx1 - левый/правый, cy0/cy1 - верхний/нижний (у окружности они совпадают).
+// При xa == 0 отрезки на осях сливаются с прямыми сторонами между центрами
+static void st7735roundspans(int16_t cx0, int16_t cy0, int16_t cx1, int16_t cy1,
+                             int16_t xa, int16_t xb, int16_t y, unsigned int color)
+{
+  if (xa == 0) {
+    st7735hline(cx0 - xb, cx1 + xb, cy0 - y, color);
+    st7735hline(cx0 - xb, cx1 + xb, cy1 + y, color);
+    st7735vline(cx0 - y, cy0 - xb, cy1 + xb, color);
+    st7735vline(cx1 + y, cy0 - xb, cy1 + xb, color);
+    return;
+  }
+  st7735hline(cx0 - xb, cx0 - xa, cy0 - y, color);
+  st7735hline(cx1 + xa, cx1 + xb, cy0 - y, color);
+  st7735hline(cx0 - xb, cx0 - xa, cy1 + y, color);
+  st7735hline(cx1 + xa, cx1 + xb, cy1 + y, color);
+  if (xb >= y) xb = y - 1; // точка на диагонали уже выведена горизонтальным отрезком
+  if (xb < xa) return;
+  st7735vline(cx0 - y, cy0 - xb, cy0 - xa, color);
+  st7735vline(cx1 + y, cy0 - xb, cy0 - xa, color);
+  st7735vline(cx0 - y, cy1 + xa, cy1 + xb, color);
+  st7735vline(cx1 + y, cy1 + xa, cy1 + xb, color);
+}
+
+// контур скругления радиуса r по алгоритму средней точки: точки с одинаковым y
+// копятся в отрезок и выводятся восемью (по симметрии) заливками
+static void st7735roundoutline(int16_t cx0, int16_t cy0, int16_t cx1, int16_t cy1, int16_t r, unsigned int color)
+{
+  int16_t x = 0, y = r, d = 1 - r, start = 0;
+  int16_t nx, ny;
+  while (x <= y) {
+    nx = x + 1;
+    ny = y;
+    if (d < 0) d += 2 * x + 3;
+    else     { d += 2 * (x - y) + 5; ny = y - 1; }
+    if (ny != y || nx > ny) { // y сменится или октант кончился - выводим накопленный отрезок
+      st7735roundspans(cx0, cy0, cx1, cy1, start, x, y, color);
+      start = nx;
+    }
+    x = nx;
+    y = ny;
+  }
+}
+
+// заливка скругления: средняя полоса одним окном, затем по горизонтальному отрезку на строку
+static void st7735roundfill(int16_t cx0, int16_t cy0, int16_t cx1, int16_t cy1, int16_t r, unsigned int color)
+{
+  int16_t x = 0, y = r, d = 1 - r;
+  int16_t ny;
+  st7735fillrect(cx0 - r, cy0, cx1 + r, cy1, color);
+  while (x <= y) {
+    if (x) { // строки cy±x, полуширина y
+      st7735hline(cx0 - y, cx1 + y, cy0 - x, color);
+      st7735hline(cx0 - y, cx1 + y, cy1 + x, color);
+    }
+    ny = y;
+    if (d < 0) d += 2 * x + 3;
+    else     { d += 2 * (x - y) + 5; ny = y - 1; }
+    // строки cy±y закончились, когда y сменился; при y == x они уже выведены выше
+    if (ny != y && y != x) {
+      st7735hline(cx0 - x, cx1 + x, cy0 - y, color);
+      st7735hline(cx0 - x, cx1 + x, cy1 + y, color);
+    }
+    x++;
+    y = ny;
+  }
+}
+
+// окружность
+void st7735circle(int16_t X, int16_t Y, unsigned char R, unsigned int color)
+{
+  st7735roundoutline(X, Y, X, Y, R, color);
+}
+
+// заполненный круг
+void st7735fillcircle(int16_t X, int16_t Y, unsigned char R, unsigned int color)
+{
+  st7735roundfill(X, Y, X, Y, R, color);
+}
+
+// прямоугольник со скруглёнными углами (не заполненный), R не больше половины меньшей стороны
+void st7735roundrect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, unsigned char R, unsigned int color)
+{
+  st7735roundoutline(x1 + R, y1 + R, x2 - R, y2 - R, R, color);
+}
+
+// заполненный прямоугольник со скруглёнными углами
+void st7735fillroundrect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, unsigned char R, unsigned int color)
+{
+  st7735roundfill(x1 + R, y1 + R, x2 - R, y2 - R, R, color);
+}
+
+// таблица образцов для 1-битной матрицы: на каждое значение полубайта 4 готовых слова цвета
+// в порядке вывода точек (64 слова), строится один раз на символ
+static void st7735niblut(uint16_t *lut, uint16_t fcolor, uint16_t bcolor)
+{
+  unsigned char v, k;
+  for (v = 0; v < 16; v++)
+    for (k = 0; k < 4; k++)
+      *lut++ = ((v >> k) & 1) ? fcolor : bcolor;
+}
+
+// n точек строки матрицы BITS_RB в строку цветов: за шаг полубайт, 4 слова из таблицы
+// st7735niblut() - ни проверки бита, ни ветвления на точку. Первым идёт младший полубайт
+static void st7735nibrow(uint16_t *line, const unsigned char *p, unsigned char n, const uint16_t *lut)
+{
+  unsigned char k;
+  const uint16_t *a, *b;
+  for (; n >= 8; n -= 8, line += 8, p++) {
+    a = lut + ((*p & 0x0F) << 2);
+    b = lut + ((*p >> 4) << 2);
+    line[0] = a[0]; line[1] = a[1]; line[2] = a[2]; line[3] = a[3];
+    line[4] = b[0]; line[5] = b[1]; line[6] = b[2]; line[7] = b[3];
+  }
+  if (n) {
+    a = lut + ((*p & 0x0F) << 2);
+    b = lut + ((*p >> 4) << 2);
+    for (k = 0; k < n; k++) line[k] = (k < 4) ? a[k] : b[k - 4];
+  }
+}
+
+// отправка строки цветов через DMA внутри открытого RAMWR, сеанс не закрывается
+static void st7735dmaline(const uint16_t *line, uint16_t count)
+{
+  st7735dmawait(); // предыдущая строка ушла, её буфер снова свободен
+  dma_close = 0;
+  dma_left  = 0;
+  dma_busy  = 1;
+  st7735dmastart(line, count, DMA_CCR_MINC);
+}
+
+// номер младшего и старшего единичного бита в ненулевом байте
+static void st7735bitspan(unsigned char b, unsigned char *lo, unsigned char *hi)
+{
+  unsigned char i = 0;
+  while (!(b & 1)) { b >>= 1; i++; }
+  *lo = i;
+  while (b >>= 1) i++;
+  *hi = i;
+}
+
+// рамка, в которой матрицы BITS_RB двух символов отличаются: box = {x0, y0, x1, y1}.
+// Возвращает 0, если символы одинаковые
+static uint8_t st7735glyphdiff(const unsigned char *a, const unsigned char *b,
+                               unsigned char width, unsigned char height, unsigned char box[4])
+{
+  unsigned char bytes = (width + 7) >> 3; // байт в строке матрицы
+  unsigned char l, k, x, lo, hi;
+  box[0] = box[1] = 255;
+  box[2] = box[3] = 0;
+  for (l = 0; l < height; l++)
+    for (k = 0; k < bytes; k++) {
+      x = *a++ ^ *b++;
+      if (!x) continue;
+      st7735bitspan(x, &lo, &hi); // l - строка, биты - столбцы
+      if (k * 8 + lo < box[0]) box[0] = k * 8 + lo;
+      if (k * 8 + hi > box[2]) box[2] = k * 8 + hi;
+      if (l < box[1]) box[1] = l;
+      if (l > box[3]) box[3] = l;
+    }
+  if (box[0] > box[2]) return 0;
+  if (box[2] >= width)  box[2] = width - 1;  // биты выравнивания матрицы на экран не идут
+  if (box[3] >= height) box[3] = height - 1;
+  return box[0] <= box[2] && box[1] <= box[3];
+}
+
+// уровень l из max между bcolor (0) и fcolor (max).
+// Каналы смешиваются по отдельности, порядок R/B в слове (RGB/BGR) не важен
+static uint16_t st7735mix(uint16_t fcolor, uint16_t bcolor, unsigned char l, unsigned char max)
+{
+  int16_t fr = fcolor >> 11, fg = (fcolor >> 5) & 0x3F, fb = fcolor & 0x1F;
+  int16_t br = bcolor >> 11, bg = (bcolor >> 5) & 0x3F, bb = bcolor & 0x1F;
+  return ((br + (fr - br) * l / max) << 11) |
+         ((bg + (fg - bg) * l / max) << 5)  |
+          (bb + (fb - bb) * l / max);
+}
+
+// таблица смешивания fcolor и bcolor на levels уровней: lut[0] = bcolor, lut[levels-1] = fcolor
+static void st7735blendlut(uint16_t *lut, unsigned char levels, uint16_t fcolor, uint16_t bcolor)
+{
+  unsigned char l;
+  for (l = 0; l < levels; l++) lut[l] = st7735mix(fcolor, bcolor, l, levels - 1);
+}
+
+// строка сглаженной матрицы в строку цветов: только выборка из таблицы, без арифметики
+static void st7735grayrow(uint16_t *line, const unsigned char *row, unsigned char count,
+                          const uint16_t *lut, unsigned char bpp)
+{
+  unsigned char b;
+  if (bpp == 4) {
+    for (; count >= 2; count -= 2) {
+      b = *row++;
+      *line++ = lut[b >> 4];
+      *line++ = lut[b & 0x0F];
+    }
+    if (count) *line = lut[*row >> 4];
+    return;
+  }
+  for (; count >= 4; count -= 4) {
+    b = *row++;
+    *line++ = lut[b >> 6];
+    *line++ = lut[(b >> 4) & 0x03];
+    *line++ = lut[(b >> 2) & 0x03];
+    *line++ = lut[b & 0x03];
+  }
+  for (b = *row; count; count--, b <<= 2) *line++ = lut[b >> 6];
+}
+
+// матрица символа по описанию шрифта, 0 - символа в шрифте нет. Без поиска: O(1)
+const unsigned char *st7735glyph(const st7735_font *f, unsigned char CH)
+{
+  uint8_t  n = CH - f->first;
+  uint16_t offset;
+  if (CH < f->first || n >= f->count) return 0;
+  if (!f->remap) return f->data + (uint32_t)n * f->glyphbytes;
+  offset = f->remap[n];
+  if (offset == ST7735_NOGLYPH) return 0;
+  return f->data + offset;
+}
+
+// строка r матрицы в строку цветов по таблице st7735fontlut(): у BITS_RB - образцы
+// полубайтов, у остальных lut[0] - фон, lut[levels-1] - цвет шрифта.
+// На каждую развёртку своя функция: внутри цикла никаких проверок порядка бит
+typedef void (*st7735rowfn)(uint16_t *line, const unsigned char *glyph, unsigned char r,
+                            const st7735_font *f, const uint16_t *lut);
+
+static void st7735row_rb(uint16_t *line, const unsigned char *glyph, unsigned char r,
+                         const st7735_font *f, const uint16_t *lut)
+{
+  st7735nibrow(line, glyph + r * ((f->width + 7) >> 3), f->width, lut);
+}
+
+static void st7735row_g2(uint16_t *line, const unsigned char *glyph, unsigned char r,
+                         const st7735_font *f, const uint16_t *lut)
+{
+  st7735grayrow(line, glyph + r * ((f->width * 2 + 7) >> 3), f->width, lut, 2);
+}
+
+static void st7735row_g4(uint16_t *line, const unsigned char *glyph, unsigned char r,
+                         const st7735_font *f, const uint16_t *lut)
+{
+  st7735grayrow(line, glyph + r * ((f->width * 4 + 7) >> 3), f->width, lut, 4);
+}
+
+// по bitorder шрифта: функция строки и число уровней в таблице цветов
+static const struct {
+  st7735rowfn   row;
+  unsigned char levels;
+} st7735rows[] = {
+  { st7735row_rb,   2 }, // BITS_RB
+  { st7735row_g2,   4 }, // BITS_G2
+  { st7735row_g4,  16 }, // BITS_G4
+};
+
+// таблица цветов символа для функции строки его развёртки
+static void st7735fontlut(uint16_t *lut, unsigned char bitorder, uint16_t fcolor, uint16_t bcolor)
+{
+  if (bitorder == BITS_RB) st7735niblut(lut, fcolor, bcolor);
+  else                     st7735blendlut(lut, st7735rows[bitorder].levels, fcolor, bcolor);
+}
+
+// отрезок из n точек одного цвета: одно и то же слово в SPI, без проверки битов
+static inline void st7735run(uint16_t color, uint16_t n)
+{
+  while (n--) {
+    while (!(SPI1->SR & SPI_SR_TXE));
+    SPIDR16BIT = color;
+  }
+}
+
+// отрезок из n точек матрицы шириной width, начинающийся в точке (pos->x0, pos->y0):
+// в SPI уходит только то, что попало в видимую часть v (в координатах матрицы)
+static void st7735runclip(uint16_t color, uint16_t n, unsigned char width,
+                          const st7735_rect *v, st7735_rect *pos)
+{
+  int16_t a, b, k;
+  while (n) {
+    k = width - pos->x0;                // до конца строки матрицы
+    if (k > n) k = n;
+    if (pos->y0 >= v->y0 && pos->y0 <= v->y1) {
+      a = (pos->x0 > v->x0) ? pos->x0 : v->x0;
+      b = (pos->x0 + k - 1 < v->x1) ? pos->x0 + k - 1 : v->x1;
+      if (a <= b) st7735run(color, b - a + 1);
+    }
+    pos->x0 += k;
+    n       -= k;
+    if (pos->x0 == width) {
+      pos->x0 = 0;
+      pos->y0++;
+    }
+  }
+}
+
+// вывод сжатого символа (BITS_RLE): матрица не распаковывается в память,
+// отрезки фон/цвет сразу уходят в SPI. Формат - см. BITS_RLE в lcd7735sl.h
+void print_char_rle(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor)               // цвет фона
+{
+  const unsigned char *p = st7735glyph(f, CH);
+  uint16_t total = f->width * f->height; // сколько точек ещё вывести
+  uint16_t bg, fg;
+  uint8_t  whole;
+  st7735_rect v;
+  st7735_rect p0 = { 0, 0, 0, 0 };      // x0, y0 - где в матрице начинается очередной отрезок
+
+  if (!p) return;
+  if (!st7735clip(X, Y, X + f->width - 1, Y + f->height - 1, &v)) return;
+  whole = st7735whole(&v, X, Y, X + f->width - 1, Y + f->height - 1);
+  st7735begin();
+  st7735setwin(v.x0, v.y0, v.x1, v.y1);
+  st7735ramwr();
+  st7735stats.sent += 2 * (v.x1 - v.x0 + 1) * (v.y1 - v.y0 + 1);
+  v.x0 -= X; v.x1 -= X; v.y0 -= Y; v.y1 -= Y; // дальше - в координатах матрицы
+
+  while (total) {
+    bg = *p >> 4;
+    fg = *p++ & 0x0F;
+    if (bg == 15) bg += *p++;           // длинный отрезок фона
+    if (bg > total) bg = total;         // испорченная матрица не должна выйти за окно
+    total -= bg;
+    if (fg > total) fg = total;
+    total -= fg;
+    if (whole) {
+      st7735run(bcolor, bg);
+      st7735run(fcolor, fg);
+    } else {                            // отрезки режутся по видимой части
+      st7735runclip(bcolor, bg, f->width, &v, &p0);
+      st7735runclip(fcolor, fg, f->width, &v, &p0);
+    }
+  }
+  st7735end();
+}
+
+// матрица glyph размером f->width x f->height построчно через DMA, lut - цвета уровней.
+// Выводится только часть, видимая в текущей области отсечения
+static void st7735glyphdma(const st7735_font *f, const unsigned char *glyph,
+                           unsigned char X, unsigned char Y, const uint16_t *lut)
+{
+  st7735rowfn row = st7735rows[f->bitorder].row;
+  unsigned char r, c0, w;
+  unsigned char cur = 0;
+  st7735_rect v;
+
+  if (!st7735clip(X, Y, X + f->width - 1, Y + f->height - 1, &v)) return;
+  c0 = v.x0 - X;
+  w  = v.x1 - v.x0 + 1;
+
+  st7735begin();
+  st7735setwin(v.x0, v.y0, v.x1, v.y1);
+  st7735ramwr();
+  st7735stats.sent += 2 * w * (v.y1 - v.y0 + 1);
+
+  // строка раскладывается целиком, в SPI идут столбцы c0..c0+w-1
+  row(linebuf[0], glyph, v.y0 - Y, f, lut);
+  for (r = v.y0 - Y; r <= v.y1 - Y; r++) {
+    st7735dmaline(linebuf[cur] + c0, w);
+    cur ^= 1;
+    if (r < v.y1 - Y) row(linebuf[cur], glyph, r + 1, f, lut);
+  }
+  st7735dmawait();
+  st7735dmaclose();
+}
+
+// вывод символа по описанию шрифта через DMA, функция строки выбирается один раз на символ
+void print_char_font(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor)               // цвет фона
+{
+  const unsigned char *glyph = st7735glyph(f, CH);
+  uint16_t lut[ST7735_LUT];
+
+  if (f->bitorder == BITS_RLE)     { print_char_rle(f, CH, X, Y, fcolor, bcolor); return; }
+  if (f->flags & ST7735_FONT_BOX) { print_char_box(f, CH, X, Y, fcolor, bcolor, 1); return; }
+  if (!glyph || f->width > ST7735_LINEBUF || f->bitorder > BITS_G4) return;
+  st7735fontlut(lut, f->bitorder, fcolor, bcolor);
+  st7735glyphdma(f, glyph, X, Y, lut);
+}
+
+// вывод символа, обрезанного по рамке (ST7735_FONT_BOX): поля вокруг рамки заливаются
+// фоном целиком (margins = 1) или не трогаются вовсе (margins = 0, фон там уже есть),
+// побитно раскладывается только то, что внутри рамки
+void print_char_box(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты знакоместа
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor,               // цвет фона
+                unsigned char margins)             // 1 - залить поля фоном
+{
+  const unsigned char *glyph = st7735glyph(f, CH);
+  unsigned char ex = X + f->width - 1, ey = Y + f->height - 1; // правый нижний угол знакоместа
+  unsigned char x0, y0, x1, y1;                                // рамка на экране
+  st7735_font ink;
+  uint16_t lut[ST7735_LUT];
+
+  if (!glyph || f->bitorder > BITS_G4) return;
+  ink        = *f;
+  ink.width  = glyph[2];
+  ink.height = glyph[3];
+  if (!ink.width || !ink.height) { // пустой символ (пробел) - одно знакоместо фона
+    if (margins) st7735fillrect_dma(X, Y, ex, ey, bcolor, 0);
+    return;
+  }
+  if (ink.width > ST7735_LINEBUF) return;
+  x0 = X + glyph[0];
+  y0 = Y + glyph[1];
+  x1 = x0 + ink.width - 1;
+  y1 = y0 + ink.height - 1;
+  if (margins) {
+    if (y0 > Y)  st7735fillrect_dma(X, Y, ex, y0 - 1, bcolor, 0);  // сверху
+    if (y1 < ey) st7735fillrect_dma(X, y1 + 1, ex, ey, bcolor, 0); // снизу
+    if (x0 > X)  st7735fillrect_dma(X, y0, x0 - 1, y1, bcolor, 0); // слева
+    if (x1 < ex) st7735fillrect_dma(x1 + 1, y0, ex, y1, bcolor, 0); // справа
+  }
+  st7735fontlut(lut, f->bitorder, fcolor, bcolor);
+  st7735glyphdma(&ink, glyph + 4, x0, y0, lut);
+}
+
+// n точек строки, увеличенной в scale раз: каждая точка src повторяется scale раз,
+// phase - сколько повторов первой точки уже выведено в предыдущем куске
+static void st7735scalerow(uint16_t *line, const uint16_t *src, unsigned char phase,
+                           unsigned char n, unsigned char scale)
+{
+  uint16_t c = *src++;
+  while (n--) {
+    *line++ = c;
+    if (++phase == scale && n) {
+      phase = 0;
+      c = *src++;
+    }
+  }
+}
+
+// вывод символа, увеличенного в scale раз: точки и строки повторяются прямо при выводе,
+// в памяти только строка матрицы. Увеличенная строка уходит через DMA кусками по
+// ST7735_LINEBUF точек; если она помещается в один кусок - раскладывается один раз на scale строк.
+// Выводится только часть, видимая в текущей области отсечения
+void print_char_scaled(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты
+                unsigned char scale,               // во сколько раз увеличить
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor)               // цвет фона
+{
+  const unsigned char *glyph = st7735glyph(f, CH);
+  uint16_t W = f->width * scale, H = f->height * scale; // размер на экране
+  uint16_t src[ST7735_LINEBUF];                         // строка матрицы в исходном размере
+  uint16_t lut[ST7735_LUT];
+  uint16_t x, y, c0, w;                                 // видимые столбцы c0..c0+w-1 увеличенного символа
+  st7735rowfn row;
+  st7735_rect v;
+  unsigned char r, fresh, n;
+  unsigned char last = 255;                             // строка матрицы, разложенная в src
+  unsigned char cur = 0;
+
+  if (scale == 1) { print_char_font(f, CH, X, Y, fcolor, bcolor); return; }
+  // у BITS_RLE и ST7735_FONT_BOX нет строк матрицы полного размера
+  if (!glyph || !scale || f->bitorder > BITS_G4 || (f->flags & ST7735_FONT_BOX) || f->width > ST7735_LINEBUF) return;
+  if (!st7735clip(X, Y, X + W - 1, Y + H - 1, &v)) return;
+  c0 = v.x0 - X;
+  w  = v.x1 - v.x0 + 1;
+  row = st7735rows[f->bitorder].row;
+  st7735fontlut(lut, f->bitorder, fcolor, bcolor);
+
+  st7735begin();
+  st7735setwin(v.x0, v.y0, v.x1, v.y1);
+  st7735ramwr();
+  st7735stats.sent += 2 * w * (v.y1 - v.y0 + 1);
+
+  for (y = v.y0 - Y; y <= v.y1 - Y; y++) {
+    r     = y / scale;
+    fresh = (r != last);
+    if (fresh) {
+      row(src, glyph, r, f, lut);
+      last = r;
+    }
+    for (x = c0; x < c0 + w; x += n) {
+      n = (c0 + w - x > ST7735_LINEBUF) ? ST7735_LINEBUF : c0 + w - x;
+      // раскладываем в буфер, ушедший в SPI раньше текущего
+      if (fresh || w > ST7735_LINEBUF) {
+        cur ^= 1;
+        st7735scalerow(linebuf[cur], src + x / scale, x % scale, n, scale);
+      }
+      st7735dmaline(linebuf[cur], n);
+    }
+  }
+  st7735dmawait();
+  st7735dmaclose();
+}
+
+// строка символов, увеличенных в scale раз, до первого символа, которого нет в шрифте
+void print_string_scaled(const st7735_font *f, const char *str,
+                unsigned char X, unsigned char Y,  // координаты левого верхнего угла
+                unsigned char scale,               // во сколько раз увеличить
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor)               // цвет фона
+{
+  const unsigned char *str8 = (const unsigned char *)str;
+  uint16_t step = f->width * scale;
+  for (; *str8 && st7735glyph(f, *str8) && X + step - 1 <= 255; str8++, X += step)
+    print_char_scaled(f, *str8, X, Y, scale, fcolor, bcolor);
+}
+
+// вывод строки одним окном и одной командой RAMWR: строки матриц символов идут вперемежку -
+// строка 0 всех символов, строка 1 всех символов и т.д. Любой BITS_*, строка обрывается
+// на первом символе, которого в шрифте нет
+void print_string_font(const st7735_font *f, const char *str,
+                unsigned char X, unsigned char Y,  // координаты левого верхнего угла
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor)               // цвет фона
+{
+  const unsigned char *str8 = (const unsigned char *)str;
+  unsigned int  count = 0, i;
+  st7735rowfn   row;
+  uint16_t      lut[ST7735_LUT];
+  unsigned char r;
+  unsigned char cur = 0;
+  st7735_rect   v;
+
+  while (str8[count] && st7735glyph(f, str8[count])) count++;
+  // окно не должно выйти за 255 - координаты у нас в байте
+  while (count && X + count * f->width - 1 > 255) count--;
+  if (count == 0) return;
+  if (!st7735clip(X, Y, X + count * f->width - 1, Y + f->height - 1, &v)) return; // не видно ничего
+  // матрицы разной длины или строка видна не целиком - посимвольно, каждый символ режется сам
+  if (f->bitorder == BITS_RLE || (f->flags & ST7735_FONT_BOX) ||
+      !st7735whole(&v, X, Y, X + count * f->width - 1, Y + f->height - 1)) {
+    for (i = 0; i < count; i++, X += f->width)
+      print_char_font(f, str8[i], X, Y, fcolor, bcolor);
+    return;
+  }
+  if (f->width > ST7735_LINEBUF || f->bitorder > BITS_G4) return;
+  row = st7735rows[f->bitorder].row;
+  st7735fontlut(lut, f->bitorder, fcolor, bcolor);
+
+  st7735begin();
+  st7735setwin(X, Y, X + count * f->width - 1, Y + f->height - 1);
+  st7735ramwr();
+  st7735stats.sent += 2 * count * f->width * f->height;
+
+  row(linebuf[0], st7735glyph(f, str8[0]), 0, f, lut);
+  for (r = 0; r < f->height; r++) {
+    for (i = 0; i < count; i++) {
+      st7735dmaline(linebuf[cur], f->width);
+      cur ^= 1;
+      if (i + 1 < count)           row(linebuf[cur], st7735glyph(f, str8[i + 1]), r, f, lut);
+      else if (r + 1 < f->height)  row(linebuf[cur], st7735glyph(f, str8[0]), r + 1, f, lut);
+    }
+  }
+  st7735dmawait();
+  st7735dmaclose();
+}
+
+#if ST7735_GCACHE_SLOTS
+// кэш развёрнутых символов: слот вытесняется по давности использования (LRU)
+static struct {
+  const st7735_font *font; // 0 - слот пуст
+  uint16_t fcolor, bcolor;
+  uint16_t used;           // отметка последнего использования
+  uint8_t  ch;
+} gcache[ST7735_GCACHE_SLOTS];
+static uint16_t gcachepix[ST7735_GCACHE_SLOTS][ST7735_GCACHE_PIXELS];
+static uint16_t gcacheclock;
+
+void st7735gcacheclear(void)
+{
+  unsigned char i;
+  st7735dmawait(); // слот может ещё уходить в SPI
+  for (i = 0; i < ST7735_GCACHE_SLOTS; i++) gcache[i].font = 0;
+  gcacheclock = 0;
+}
+
+void print_char_cached(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor)               // цвет фона
+{
+  const unsigned char *glyph;
+  uint16_t count = f->width * f->height;
+  uint16_t lut[ST7735_LUT];
+  unsigned char i, s = 0, r;
+
+  st7735_rect v;
+
+  if (!st7735clip(X, Y, X + f->width - 1, Y + f->height - 1, &v)) return;
+  // в слоте символ целиком: обрезанный выводится без кэша
+  if (f->bitorder > BITS_G4 || (f->flags & ST7735_FONT_BOX) || count > ST7735_GCACHE_PIXELS ||
+      !st7735whole(&v, X, Y, X + f->width - 1, Y + f->height - 1)) {
+    print_char_font(f, CH, X, Y, fcolor, bcolor);
+    return;
+  }
+  if (++gcacheclock == 0) { // отметки переполнились - начинаем отсчёт заново, порядок теряется
+    for (i = 0; i < ST7735_GCACHE_SLOTS; i++) gcache[i].used = 0;
+    gcacheclock = 1;
+  }
+  for (i = 0; i < ST7735_GCACHE_SLOTS; i++) {
+    if (gcache[i].font == f && gcache[i].ch == CH && gcache[i].fcolor == fcolor && gcache[i].bcolor == bcolor) break;
+    if (gcache[i].used < gcache[s].used) s = i; // самый давний - кандидат на вытеснение
+  }
+  if (i < ST7735_GCACHE_SLOTS) {
+    s = i;
+    st7735stats.hit++;
+  } else {
+    if (!(glyph = st7735glyph(f, CH))) return;
+    st7735stats.miss++;
+    st7735dmawait(); // вытесняемый слот может ещё уходить в SPI
+    st7735fontlut(lut, f->bitorder, fcolor, bcolor);
+    for (r = 0; r < f->height; r++) st7735rows[f->bitorder].row(gcachepix[s] + r * f->width, glyph, r, f, lut);
+    gcache[s].font   = f;
+    gcache[s].ch     = CH;
+    gcache[s].fcolor = fcolor;
+    gcache[s].bcolor = bcolor;
+  }
+  gcache[s].used = gcacheclock;
+
+  st7735begin();
+  st7735setwin(X, Y, X + f->width - 1, Y + f->height - 1);
+  st7735ramwr();
+  st7735stats.sent += 2 * count;
+  dma_left  = 0;
+  dma_done  = 0;
+  dma_close = 1;
+  dma_busy  = 1;
+  st7735dmastart(gcachepix[s], count, DMA_CCR_MINC);
+}
+#else
+void st7735gcacheclear(void)
+{
+}
+
+void print_char_cached(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor)               // цвет фона
+{
+  print_char_font(f, CH, X, Y, fcolor, bcolor);
+}
+#endif
+
+#if ST7735_BENCH
+extern volatile uint32_t ttms;
+
+// такты ядра от старта: миллисекунды SysTick плюс то, что счётчик уже отсчитал в текущей
+static uint32_t st7735cycles(void)
+{
+  uint32_t ms, val;
   do {
-    MatrixByte    = *MatrixPointer;     // чтение очередного байта матрицы
-    
-    MatrixPointer =  MatrixPointer + 1; // после чтения передвинем указатель на следующий байт матрицы
-    MatrixLength  =  MatrixLength  - 1; // можно писать просто MatrixLength--; но мне так не нравится...
-    BitMask       =  0b00000001;        // предустановка маски и ширины символа на начало для каждого прочитанного байта
-    do {
-      while (!(SPI1->SR & SPI_SR_TXE)) {}; // ждём TXE перед отправкой (проверка есть ли данные в SPI)
-      if ((MatrixByte & BitMask) > 0) SPI1->DR = fcolor; // вывод в поток точки цвета символа
-      else                            SPI1->DR = bcolor; // вывод в поток точки цвета фона
-      BitMask  = BitMask << 1; // как только бит выедет вправо, BitMask станет равен 0. Значит, вывели все 8 битов в поток
-      BitWidth = BitWidth - 1; // как только значение станет равным 0. Значит, все биты строки вывели в поток
-    } while ((BitWidth > 0) && (BitMask > 0)); // если хоть что-то стало 0, надо читать следующий байт - выходим из этого цикла
-    if (BitWidth == 0) BitWidth = SymbolWidth; // если выход был по окончании вывода строки - снова предустановим счётчик
-                                               // один раз на символ предустановка лишняя, но организовывать проверку
-                                               // окажется много дороже, чем один лишний раз присвоить значение
-  } while (MatrixLength > 0);
-  // закончили
-  while (!(SPI1->SR & SPI_SR_TXE) || (SPI1->SR & SPI_SR_BSY)) {};
-  CS_UP;
-  SPI2EIGHT;
-} // print_char_sl()
+    ms  = ttms;
+    val = SysTick->VAL;
+  } while (ms != ttms); // тик пришёлся между чтениями - читаем ещё раз
+  return ms * (SysTick->LOAD + 1) + (SysTick->LOAD - val);
+}
+
+// раскладка строки матрицы BITS_RB в строку цветов побитовым циклом - для сравнения
+static void st7735expandrow(uint16_t *line, const unsigned char *row, unsigned char count,
+                            uint16_t fcolor, uint16_t bcolor)
+{
+  unsigned char MatrixByte = *row++;
+  unsigned char BitMask    = 0b00000001;
+  while (count--) {
+    if (BitMask == 0) { // байт кончился - берём следующий
+      MatrixByte = *row++;
+      BitMask    = 0b00000001;
+    }
+    *line++ = (MatrixByte & BitMask) ? fcolor : bcolor;
+    BitMask <<= 1;
+  }
+}
+
+// раскладка всех символов шрифта в строку цветов passes раз: побитовый цикл st7735expandrow()
+// против полубайтовой таблицы (вместе с её построением на каждый символ). SPI не трогается
+void st7735bench_expand(const st7735_font *f, unsigned char passes, st7735_bench_t *res)
+{
+  uint16_t lut[ST7735_LUT];
+  const unsigned char *glyph;
+  unsigned char bytes = (f->width + 7) >> 3, pass, c, r;
+  uint32_t t;
+
+  res->pixels = res->oldcycles = res->newcycles = 0;
+  if (f->bitorder != BITS_RB || f->width > ST7735_LINEBUF) return;
+
+  t = st7735cycles();
+  for (pass = 0; pass < passes; pass++)
+    for (c = 0; c < f->count; c++)
+      if ((glyph = st7735glyph(f, f->first + c)))
+        for (r = 0; r < f->height; r++)
+          st7735expandrow(linebuf[0], glyph + r * bytes, f->width, CWHITE0, CBLACK);
+  res->oldcycles = st7735cycles() - t;
+
+  t = st7735cycles();
+  for (pass = 0; pass < passes; pass++)
+    for (c = 0; c < f->count; c++)
+      if ((glyph = st7735glyph(f, f->first + c))) {
+        st7735fontlut(lut, f->bitorder, CWHITE0, CBLACK);
+        for (r = 0; r < f->height; r++) st7735rows[f->bitorder].row(linebuf[0], glyph, r, f, lut);
+        res->pixels += f->width * f->height;
+      }
+  res->newcycles = st7735cycles() - t;
+}
+#endif
+
+// n столбцов строки r текста str (len символов) начиная со столбца c текста: символы режутся
+// по краям куска, слева от начала (c < 0), за концом текста и вместо неизвестных символов - фон
+static void st7735textcols(uint16_t *line, const st7735_font *f, const unsigned char *str, uint16_t len,
+                           unsigned char r, int16_t c, unsigned char n, const uint16_t *lut, uint16_t bcolor)
+{
+  uint16_t src[ST7735_LINEBUF]; // строка символа целиком
+  const unsigned char *glyph;
+  unsigned char col, cnt, k;
+
+  while (n) {
+    if (c < 0) { // поле до начала текста
+      glyph = 0;
+      col   = 0;
+      cnt   = (-c > n) ? n : -c;
+    } else {
+      glyph = ((uint16_t)c / f->width < len) ? st7735glyph(f, str[(uint16_t)c / f->width]) : 0;
+      col   = (uint16_t)c % f->width;
+      cnt   = f->width - col;
+      if (cnt > n) cnt = n;
+    }
+    if (glyph) {
+      st7735rows[f->bitorder].row(src, glyph, r, f, lut);
+      for (k = 0; k < cnt; k++) line[k] = src[col + k];
+    } else {
+      for (k = 0; k < cnt; k++) line[k] = bcolor;
+    }
+    line += cnt;
+    c    += cnt;
+    n    -= cnt;
+  }
+}
 
+// окно шириной W точек на текст str, сдвинутый так, что у левого края окна его столбец offset:
+// первый и последний символы режутся посреди матрицы. Одно окно и один RAMWR, строка экрана
+// собирается кусками по ST7735_LINEBUF точек, пока предыдущий кусок уходит через DMA
+void print_string_window(const st7735_font *f, const char *str,
+                unsigned char X, unsigned char Y,  // левый верхний угол окна
+                unsigned char W,                   // ширина окна
+                int16_t offset,                    // столбец текста у левого края окна, < 0 - поле фона
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor)               // цвет фона
+{
+  const unsigned char *str8 = (const unsigned char *)str;
+  uint16_t len = 0;
+  uint16_t lut[ST7735_LUT];
+  unsigned char r, x, n, w;
+  unsigned char cur = 0;
+  st7735_rect v;
+
+  // у BITS_RLE и ST7735_FONT_BOX нет строк матрицы полного размера
+  if (!W || f->bitorder > BITS_G4 || (f->flags & ST7735_FONT_BOX) || f->width > ST7735_LINEBUF) return;
+  if (!st7735clip(X, Y, X + W - 1, Y + f->height - 1, &v)) return;
+  offset += v.x0 - X; // отсечённое слева - просто сдвиг текста
+  w = v.x1 - v.x0 + 1;
+  while (str8[len]) len++;
+  st7735fontlut(lut, f->bitorder, fcolor, bcolor);
+
+  st7735begin();
+  st7735setwin(v.x0, v.y0, v.x1, v.y1);
+  st7735ramwr();
+  st7735stats.sent += 2 * w * (v.y1 - v.y0 + 1);
+
+  for (r = v.y0 - Y; r <= v.y1 - Y; r++)
+    for (x = 0; x < w; x += n) {
+      n = (w - x > ST7735_LINEBUF) ? ST7735_LINEBUF : w - x;
+      cur ^= 1; // собираем в буфер, ушедший в SPI раньше текущего
+      st7735textcols(linebuf[cur], f, str8, len, r, offset + x, n, lut, bcolor);
+      st7735dmaline(linebuf[cur], n);
+    }
+  st7735dmawait();
+  st7735dmaclose();
+}
 
+// часть символа: столбцы first..first+count-1 матрицы, столбец first - в точке X
+void print_char_clip(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // где окажется столбец first
+                unsigned char first,               // первый видимый столбец матрицы
+                unsigned char count,               // сколько столбцов видно
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor)               // цвет фона
+{
+  char str[2] = { (char)CH, 0 };
+  if (first >= f->width) return;
+  if (count > f->width - first) count = f->width - first;
+  print_string_window(f, str, X, Y, count, first, fcolor, bcolor);
+}
+
+// строка, повёрнутая на rot: MADCTL переключается на время вывода и возвращается обратно
+void print_string_rot(const st7735_font *f, const char *str,
+                unsigned char X, unsigned char Y,  // левый верхний угол в повёрнутых координатах
+                uint8_t rot,                       // ST7735_ROT*
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor)               // цвет фона
+{
+  uint8_t old = st7735rotate(rot);
+  print_string_font(f, str, X, Y, fcolor, bcolor);
+  st7735rotate(old);
+}
+
+// ===================================================== //
+// DISPLAY LIST: ======================================= //
+
+void st7735dl_init(st7735_dlist *dl, st7735_dlcmd *cmds, uint8_t size)
+{
+  dl->cmds  = cmds;
+  dl->size  = size;
+  dl->count = 0;
+}
+
+void st7735dl_clear(st7735_dlist *dl)
+{
+  dl->count = 0;
+}
+
+// новая команда в конце списка, 0 - места нет
+static st7735_dlcmd *st7735dladd(st7735_dlist *dl, uint8_t type,
+                                 int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  st7735_dlcmd *c;
+  if (dl->count == dl->size) return 0;
+  c = &dl->cmds[dl->count++];
+  c->type   = type;
+  c->x0     = (x0 < x1) ? x0 : x1;
+  c->x1     = (x0 < x1) ? x1 : x0;
+  c->y0     = (y0 < y1) ? y0 : y1;
+  c->y1     = (y0 < y1) ? y1 : y0;
+  c->fcolor = color;
+  c->bcolor = color;
+  c->font   = 0;
+  c->str    = 0;
+  c->len    = 0;
+  return c;
+}
+
+uint8_t st7735dl_fill(st7735_dlist *dl, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  return st7735dladd(dl, ST7735_DL_FILL, x0, y0, x1, y1, color) != 0;
+}
+
+uint8_t st7735dl_frame(st7735_dlist *dl, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+  return st7735dladd(dl, ST7735_DL_FRAME, x0, y0, x1, y1, color) != 0;
+}
+
+uint8_t st7735dl_text(st7735_dlist *dl, const st7735_font *f, const char *str, int16_t X, int16_t Y,
+                      uint16_t fcolor, uint16_t bcolor, uint8_t flags)
+{
+  const unsigned char *str8 = (const unsigned char *)str;
+  st7735_dlcmd *c;
+  uint8_t len = 0;
+
+  // у BITS_RLE и ST7735_FONT_BOX нет строк матрицы полного размера
+  if (f->bitorder > BITS_G4 || (f->flags & ST7735_FONT_BOX) || f->width > ST7735_LINEBUF) return 0;
+  while (str8[len] && len < 255 && st7735glyph(f, str8[len])) len++;
+  if (!len) return 1; // выводить нечего
+  c = st7735dladd(dl, ST7735_DL_TEXT | (flags & ST7735_DL_NOBG),
+                  X, Y, X + len * f->width - 1, Y + f->height - 1, fcolor);
+  if (!c) return 0;
+  c->bcolor = bcolor;
+  c->font   = f;
+  c->str    = str8;
+  c->len    = len;
+  return 1;
+}
+
+// таблицы цветов текста на время одного st7735dl_render(): строятся, только когда такой ещё нет
+typedef struct {
+  struct {
+    uint16_t lut[ST7735_LUT];
+    uint16_t fcolor, bcolor;
+    uint8_t  key;              // bitorder | ST7735_DL_NOBG, 0xFF - слот пуст
+  } slot[ST7735_DL_LUTS];
+  uint8_t next;                // слот, который займёт следующая таблица
+} st7735dlluts;
+
+// таблица для текстовой команды c: с фоном - цвета, без фона - уровни точек 0..max
+static const uint16_t *st7735dllut(st7735dlluts *t, const st7735_dlcmd *c)
+{
+  uint8_t  key = c->font->bitorder | (c->type & ST7735_DL_NOBG), i;
+  uint16_t fc  = (key & ST7735_DL_NOBG) ? 1 : c->fcolor; // у уровней цвета не важны
+  uint16_t bc  = (key & ST7735_DL_NOBG) ? 0 : c->bcolor;
+  uint16_t *lut;
+
+  for (i = 0; i < ST7735_DL_LUTS; i++)
+    if (t->slot[i].key == key && t->slot[i].fcolor == fc && t->slot[i].bcolor == bc) return t->slot[i].lut;
+  i = t->next;
+  t->next = (i + 1 < ST7735_DL_LUTS) ? i + 1 : 0;
+  t->slot[i].key    = key;
+  t->slot[i].fcolor = fc;
+  t->slot[i].bcolor = bc;
+  lut = t->slot[i].lut;
+  if (key == (BITS_G2 | ST7735_DL_NOBG) || key == (BITS_G4 | ST7735_DL_NOBG)) {
+    for (i = 0; i < st7735rows[c->font->bitorder].levels; i++) lut[i] = i;
+  } else st7735fontlut(lut, c->font->bitorder, fc, bc); // у BITS_RB без фона - уровни 1 и 0
+  return lut;
+}
+
+// n точек строки y экрана начиная с x: фон bg, поверх - все команды списка по порядку
+static void st7735dlspan(const st7735_dlist *dl, st7735dlluts *luts, uint16_t *line,
+                         int16_t x, int16_t y, unsigned char n, uint16_t bg)
+{
+  const st7735_dlcmd *c   = dl->cmds;
+  const st7735_dlcmd *end = c + dl->count;
+  const st7735_font  *f;
+  const uint16_t     *lut;
+  uint16_t tmp[ST7735_LINEBUF]; // уровни точек текста без фона
+  uint16_t *p;
+  unsigned char k, w, l, max;
+
+  for (k = 0; k < n; k++) line[k] = bg;
+  for (; c < end; c++) {
+    if (y < c->y0 || y > c->y1 || x + n - 1 < c->x0 || x > c->x1) continue; // команда мимо куска
+    // пересечение команды с куском: w точек с p
+    p = line + ((c->x0 > x) ? c->x0 - x : 0);
+    w = ((c->x1 < x + n - 1) ? c->x1 - x : n - 1) - (p - line) + 1;
+    switch (c->type & ~ST7735_DL_NOBG) {
+    case ST7735_DL_FILL:
+      for (k = 0; k < w; k++) p[k] = c->fcolor;
+      break;
+    case ST7735_DL_FRAME:
+      if (y == c->y0 || y == c->y1) {
+        for (k = 0; k < w; k++) p[k] = c->fcolor;
+      } else { // боковые стороны - только если попали в кусок
+        if (c->x0 >= x)         line[c->x0 - x] = c->fcolor;
+        if (c->x1 <= x + n - 1) line[c->x1 - x] = c->fcolor;
+      }
+      break;
+    case ST7735_DL_TEXT:
+      f   = c->font;
+      lut = st7735dllut(luts, c);
+      if (!(c->type & ST7735_DL_NOBG)) { // с фоном - сразу цвета
+        st7735textcols(p, f, c->str, c->len, y - c->y0, x + (p - line) - c->x0, w, lut, c->bcolor);
+        break;
+      }
+      // без фона: уровни 0..max, точки уровня 0 не трогаем, промежуточные смешиваем с тем, что под ними
+      max = st7735rows[f->bitorder].levels - 1;
+      st7735textcols(tmp, f, c->str, c->len, y - c->y0, x + (p - line) - c->x0, w, lut, 0);
+      for (k = 0; k < w; k++) {
+        l = tmp[k];
+        if (l == max) p[k] = c->fcolor;
+        else if (l)   p[k] = st7735mix(c->fcolor, p[k], l, max);
+      }
+      break;
+    }
+  }
+}
+
+void st7735dl_render(const st7735_dlist *dl, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t bg)
+{
+  st7735_rect  v;
+  st7735dlluts luts;
+  int16_t x, y;
+  unsigned char n, i;
+  unsigned char cur = 0;
+
+  if (!st7735clip(x0, y0, x1, y1, &v)) return;
+  for (i = 0; i < ST7735_DL_LUTS; i++) luts.slot[i].key = 0xFF;
+  luts.next = 0;
+  st7735begin();
+  st7735setwin(v.x0, v.y0, v.x1, v.y1);
+  st7735ramwr();
+  st7735stats.sent += 2 * (uint32_t)(v.x1 - v.x0 + 1) * (v.y1 - v.y0 + 1);
+
+  for (y = v.y0; y <= v.y1; y++)
+    for (x = v.x0; x <= v.x1; x += n) {
+      n = (v.x1 - x + 1 > ST7735_LINEBUF) ? ST7735_LINEBUF : v.x1 - x + 1;
+      cur ^= 1; // собираем в буфер, ушедший в SPI раньше текущего
+      st7735dlspan(dl, &luts, linebuf[cur], x, y, n, bg);
+      st7735dmaline(linebuf[cur], n);
+    }
+  st7735dmawait();
+  st7735dmaclose();
+}
+
+// замена символа oldglyph на newglyph на том же месте и теми же цветами: окно открывается
+// только над рамкой, в которой матрицы отличаются (у цифр 8 -> 9 это несколько строк из 36)
+void print_glyph_diff(const unsigned char *oldglyph,   // матрица символа, который сейчас на экране
+                const unsigned char *newglyph,         // матрица нового символа
+                unsigned char X, unsigned char Y,      // координаты символа
+                unsigned char SymbolWidth,             // ширина символа (не больше ST7735_LINEBUF)
+                unsigned char SymbolHeight,            // высота символа
+                unsigned int fcolor,                   // цвет шрифта
+                unsigned int bcolor)                   // цвет фона
+{
+  unsigned char bytes = (SymbolWidth + 7) >> 3; // байт в строке матрицы
+  unsigned char box[4];
+  unsigned char r, w;
+  unsigned char cur = 0;
+  uint16_t lut[ST7735_LUT];
+  st7735_rect v;
+
+  if (SymbolWidth > ST7735_LINEBUF) return;
+  if (!st7735glyphdiff(oldglyph, newglyph, SymbolWidth, SymbolHeight, box)) return; // менять нечего
+  // рамка отличий, пересечённая с областью отсечения
+  if (!st7735clip(X + box[0], Y + box[1], X + box[2], Y + box[3], &v)) return;
+  box[0] = v.x0 - X; box[1] = v.y0 - Y;
+  box[2] = v.x1 - X; box[3] = v.y1 - Y;
+  w = box[2] - box[0] + 1;
+  st7735niblut(lut, fcolor, bcolor); // один раз на символ
+
+  st7735begin();
+  st7735setwin(v.x0, v.y0, v.x1, v.y1);
+  st7735ramwr();
+  st7735stats.sent += 2 * w * (box[3] - box[1] + 1);
+
+  // строка раскладывается целиком, в SPI идут столбцы box[0]..box[2]
+  newglyph += box[1] * bytes;
+  st7735nibrow(linebuf[0], newglyph, SymbolWidth, lut);
+  for (r = box[1]; r <= box[3]; r++) {
+    st7735dmaline(linebuf[cur] + box[0], w);
+    cur ^= 1;
+    newglyph += bytes;
+    if (r < box[3]) st7735nibrow(linebuf[cur], newglyph, SymbolWidth, lut);
+  }
+  st7735dmawait();
+  st7735dmaclose();
+}
 
 // ===================================================== //
 // OLD: ================================================ //
 
-// отправка данных\команд на дисплей
+// отправка данных\команд на дисплей (SPI только на передачу - приёмник не читаем).
+// Всё идёт через st7735begin/st7735send: ждём инициализацию и DMA, опускаем CS, а DC,
+// разрядность SPI и кэш окна остаются достоверными
 void lcd7735_senddata(unsigned char data)
 {
-  while (!(SPI1->SR & SPI_SR_TXE));
-  SPIDR8BIT = data;
-  while (!(SPI1->SR & SPI_SR_RXNE));
-  uint8_t temp = SPIDR8BIT;
+  st7735begin();
+  st7735send(DATA, data);
+  st7735end();
 }
 
 // отправка команды на дисплей с ожиданием конца передачи
 void lcd7735_sendCmd(unsigned char cmd)
 {
-  DC_DN;
-  lcd7735_senddata(cmd);
-  while(SPI1->SR & SPI_SR_BSY);
+  st7735begin();
+  st7735send(COMM, cmd);
+  st7735flush();
+  st7735end();
 }
 
 // отправка данных на дисплей с ожиданием конца передачи
 void lcd7735_sendData(unsigned char data) 
 {
-  DC_UP;
-  lcd7735_senddata(data);
-  while(SPI1->SR & SPI_SR_BSY);
+  st7735begin();
+  st7735send(DATA, data);
+  st7735flush();
+  st7735end();
 }
 
 // определение области экрана для заполнения
 void lcd7735_at(unsigned char startX, unsigned char startY, unsigned char stopX, unsigned char stopY) 
 {
-  lcd7735_sendCmd(0x2A); // ST77XX_CASET
-  DC_UP;
-  lcd7735_senddata(0x00); // ST77XX_MADCTL_RGB
-  lcd7735_senddata(startX);
-  lcd7735_senddata(0x00);
-  lcd7735_sendData(stopX);
-
-  lcd7735_sendCmd(0x2B); // ST77XX_RASET
-  DC_UP;
-  lcd7735_senddata(0x00);
-  lcd7735_senddata(startY);
-  lcd7735_senddata(0x00);
-  lcd7735_sendData(stopY);
+  st7735setwin(startX, startY, stopX, stopY);
 }
 
 // процедура заполнения прямоугольной области экрана заданным цветом
@@ -477,48 +1817,46 @@ void lcd7735_fillrect(unsigned char startX, unsigned char startY, unsigned char
 {
   unsigned char y;
   unsigned char x;
-  CS_DN;
+  st7735begin();
   lcd7735_at(startX, startY, stopX, stopY);
-  lcd7735_sendCmd(0x2C);
-  DC_UP;
-  SPI2SIXTEEN;
+  st7735ramwr();
 
   for (y=startY;y<stopY+1;y++)
     for (x=startX;x<stopX+1;x++) 
-    {
-      while (!(SPI1->SR & SPI_SR_TXE));
-      SPI1->DR = color;
-    }
-  while (!(SPI1->SR & SPI_SR_TXE) || (SPI1->SR & SPI_SR_BSY));
-  SPI2EIGHT;
-  CS_UP;
+      st7735send16(DATA, color);
+  st7735end();
 }
 
 
 // Инициализация
 void lcd7735_init(uint16_t color) 
 {
-  CS_DN; // CS=0  - начали сеанс работы с дисплеем
+  st7735begin(); // CS=0  - начали сеанс работы с дисплеем
   // сброс дисплея
   // аппаратный сброс дисплея
   RST_DN;
   delay_ms(ST7735DLY); // пауза
   RST_UP; // RST=1
   delay_ms(ST7735DLY); // пауза
+  lcd.valid = 0; // после сброса контроллер ничего не помнит
   
   // инициализация дисплея
   lcd7735_sendCmd(0x11); // после сброса дисплей спит - даем команду проснуться
   delay_ms(10); // пауза
   lcd7735_sendCmd (0x3A); // режим цвета:
   lcd7735_sendData(0x05); //             16 бит
+  lcd.colmod = 0x05;
   lcd7735_sendCmd (0x36); // направление вывода изображения:
 #ifdef RGB
   lcd7735_sendData(0x1C); // снизу вверх, справа на лево, порядок цветов RGB
+  lcd.madctl = 0x1C;
 #else
   lcd7735_sendData(0x14); // снизу вверх, справа на лево, порядок цветов BGR
+  lcd.madctl = 0x14;
 #endif
+  lcd.valid |= ST_VALID_COLMOD | ST_VALID_MADCTL;
   lcd7735_sendCmd (0x29); // включаем изображение
-  CS_UP;
+  st7735end();
   lcd7735_fillrect(0, 0, 127, 159, color);
 }
 
@@ -528,14 +1866,13 @@ void lcd7735_init(uint16_t color)
 // вывод пиксела
 void lcd7735_putpix(unsigned char x, unsigned char y, unsigned int Color)
 {
-  CS_DN;
+  st7735begin();
 
   lcd7735_at(x, y, x, y);
-  lcd7735_sendCmd(0x2C);
-  lcd7735_sendData((unsigned char)((Color & 0xFF00)>>8));
-  lcd7735_sendData((unsigned char) (Color & 0x00FF));
+  st7735ramwr();
+  st7735send16(DATA, Color);
 
-  CS_UP;
+  st7735end();
 }
 
 // процедура рисования линии
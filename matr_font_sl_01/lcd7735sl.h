@@ -32,7 +32,11 @@
 #define SPI2SIXTEEN SPI1->CR2 &= ~SPI_CR2_FRXTH; SPI1->CR2 |=  SPI_CR2_DS_3; // переключаемся на 16 бит
 #define SPI2EIGHT   SPI1->CR2 |=  SPI_CR2_FRXTH; SPI1->CR2 &= ~SPI_CR2_DS_3; // обратно на 8 бит  
 
-#define SPIDR8BIT (*(__IO uint8_t *)((uint32_t)&SPI1->DR))
+#define SPIDR8BIT  (*(__IO uint8_t  *)((uint32_t)&SPI1->DR))
+#define SPIDR16BIT (*(__IO uint16_t *)((uint32_t)&SPI1->DR))
+
+// 1 - не поднимать CS между примитивами: дисплей на шине один, а CS_UP/CS_DN на каждый вызов - лишние такты
+#define ST7735_CS_HOLD 1
 
 // Some ready-made 16-bit ('565') color settings:
 #define ST77XX_BLACK      0x0000
@@ -73,35 +77,284 @@
 #define PORTRAIT  0x00
 #define LANDSCAPE 0x01
 
-// определение области экрана для заполнения
+// поворот примитивов относительно ориентации st7735init, по часовой стрелке.
+// При ST7735_ROT90/ST7735_ROT270 ширина и высота экрана меняются местами
+#define ST7735_ROT0   0
+#define ST7735_ROT90  1
+#define ST7735_ROT180 2
+#define ST7735_ROT270 3
+
+// порядок бит в байтах матрицы шрифта. Другие развёртки (старший бит слева, по столбцам)
+// прошивка не выводит - tools/fontc переводит их в BITS_RB
+#define BITS_RB   0x00 // матрица по строкам, младший бит - левая точка (reverse bits)
+// сглаженные: матрица по строкам, левая точка в старших битах байта, строка дополняется
+// до целого байта. 0 - фон, максимум - цвет шрифта, промежуточные цвета считаются раз на символ.
+// Получаются из однобитных уменьшением: tools/fontc -o g2|g4 -x 2 (consolas_11_g2.h)
+#define BITS_G2   0x01 // 2 бита на точку
+#define BITS_G4   0x02 // 4 бита на точку
+// сжатый: точки построчно подряд, байт = (фон << 4) | цвет - столько точек фона, затем
+// столько точек цвета. Фон 15 - длинный отрезок: к 15 прибавляется следующий байт.
+// Матрицы разной длины, поэтому смещения обязательно лежат в remap
+#define BITS_RLE  0x03
+
+// размер памяти кадра: строки (длинная сторона) и столбцы
+#define ST7735_ROWS 160
+#define ST7735_COLS 128
+
+// глубина стека областей отсечения st7735clip_push() (без учёта самого экрана)
+#define ST7735_CLIPDEPTH 4
+
+// максимальная ширина символа для вывода через DMA, в точках (два буфера по 2 байта на точку)
+#define ST7735_LINEBUF 48
+
+// кэш развёрнутых в RGB565 символов для print_char_cached(): ST7735_GCACHE_SLOTS символов
+// по ST7735_GCACHE_PIXELS точек, RAM = слоты * точки * 2 байта. У F031 всего 4 КБ, из них
+// 3 КБ стек и куча, поэтому по умолчанию кэш выключен (0) - размер задаётся под плату
+#ifndef ST7735_GCACHE_SLOTS
+#define ST7735_GCACHE_SLOTS  0
+#endif
+#ifndef ST7735_GCACHE_PIXELS
+#define ST7735_GCACHE_PIXELS 256 // например, цифры 12x20
+#endif
+
+// описание шрифта: размеры, порядок бит и где искать матрицы - в одной константной структуре.
+// Символы first..first+count-1; без remap матрицы идут подряд по glyphbytes байт,
+// с remap - смещение матрицы берётся из remap[CH - first] (для шрифтов с дырами)
+#define ST7735_NOGLYPH 0xFFFF // в remap: такого символа в шрифте нет
+// флаги шрифта
+#define ST7735_FONT_BOX 0x01 // матрица обрезана по рамке изображения: 4 байта {x, y, ширина, высота}
+                             // от угла знакоместа, затем точки только внутри рамки
+
+typedef struct {
+  const unsigned char *data;       // матрицы символов
+  const uint16_t      *remap;      // смещения матриц от начала data или 0
+  uint16_t             glyphbytes; // байт на символ
+  uint8_t              width;      // ширина символа
+  uint8_t              height;     // высота символа
+  uint8_t              first;      // код первого символа
+  uint8_t              count;      // число символов
+  uint8_t              bitorder;   // BITS_RB, BITS_G2, BITS_G4 или BITS_RLE
+  uint8_t              flags;      // ST7735_FONT_*
+} st7735_font;
+
+// прямоугольник в экранных координатах, края включительно; может выходить за экран
+typedef struct {
+  int16_t x0, y0, x1, y1;
+} st7735_rect;
+
+// функция, вызываемая по окончании DMA-передачи (вызывается из прерывания!)
+typedef void (*st7735_cb)(void);
+
+// счётчики трафика на дисплей, можно обнулять между кадрами
+typedef struct {
+  uint32_t sent;  // отправлено байт: команды, параметры, пиксели
+  uint32_t saved; // сэкономлено байт на пропущенных CASET/RASET/MADCTL/COLMOD
+  uint32_t hit;   // print_char_cached(): символ взят из кэша
+  uint32_t miss;  // print_char_cached(): символ развёрнут заново
+  uint32_t clipped; // примитив целиком вне области отсечения, на дисплей ничего не ушло
+} st7735_stats_t;
+extern st7735_stats_t st7735stats;
+
+// определение области экрана для заполнения (повторно то же окно не шлётся)
 void st7735setwin(unsigned char startX, unsigned char startY, unsigned char stopX, unsigned char stopY);
+// инициализация с ожиданием окончания (паузы отсчитывает SysTick, он должен быть запущен)
 void st7735init(unsigned int orientation, unsigned int color);
+// неблокирующая инициализация: функция сразу возвращает управление, дальше шаги
+// выполняет st7735tick(); done (если не 0) вызывается из прерывания, когда экран залит
+void st7735init_start(unsigned int orientation, unsigned int color, st7735_cb done);
+// 1 - инициализация ещё идёт (примитивы сами дождутся её окончания)
+uint8_t st7735initbusy(void);
+// вызывать из SysTick_Handler раз в 1 мс
+void st7735tick(void);
+// MADCTL / COLMOD - шлются, только если значение изменилось
+void st7735madctl(uint8_t value);
+void st7735colmod(uint8_t value);
+// повернуть систему координат всех следующих примитивов (ST7735_ROT*), возвращает прежний поворот:
+// old = st7735rotate(ST7735_ROT90); ...вывод...; st7735rotate(old);
+uint8_t st7735rotate(uint8_t rot);
+// область отсечения: все примитивы и символы рисуют только внутри неё, невидимое в SPI не
+// уходит. push пересекает новую область с текущей (0 - стек полон, область не сменилась),
+// pop возвращает предыдущую. Начало координат не сдвигается. Нижняя область - весь экран
+// в текущем повороте; st7735rotate() её обновляет, а открытые области пересчитывает в новые
+// координаты - они остаются на тех же местах экрана
+uint8_t st7735clip_push(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+void st7735clip_pop(void);
+// текущая область (пустая, если x0 > x1 или y0 > y1)
+const st7735_rect *st7735clip_get(void);
+// поднять CS (при ST7735_CS_HOLD сам драйвер его не поднимает)
+void st7735release(void);
 // вывод пиксела
-void lcd7735pixel(unsigned char X, unsigned char Y, unsigned int color);
+void st7735pixel(int16_t X, int16_t Y, unsigned int color);
 // процедура заполнения прямоугольной области экрана заданным цветом
-void st7735fillrect(unsigned char startX, unsigned char startY, unsigned char stopX, unsigned char stopY, unsigned int color);
-// процедура рисования линии
-void st7735line(unsigned char x1, unsigned char y1, unsigned char x2, unsigned char y2, unsigned int color);
-
-// forward bits
-void print_char_sl_fb(unsigned char CH,            // символ который выводим
-                unsigned char X, unsigned char Y, // координаты
-                unsigned char SymbolWidth,        // ширина символа
-                unsigned char SymbolHeight,       // высота символа
-                unsigned char MatrixLength,       // длина матрицы символа
-                const unsigned char font[],       // шрифт
-                const unsigned int index[],       // индексный массив шрифта
-                unsigned int fcolor,              // цвет шрифта
-                unsigned int bcolor);             // цвет фона
-// reverse bits
-void print_char_sl_rb(unsigned char CH,            // символ который выводим
-                unsigned char X, unsigned char Y, // координаты
-                unsigned char SymbolWidth,        // ширина символа
-                unsigned char SymbolHeight,       // высота символа
-                unsigned char MatrixLength,       // длина матрицы символа
-                const unsigned char font[],       // шрифт
-                const unsigned int index[],       // индексный массив шрифта
-                unsigned int fcolor,              // цвет шрифта
-                unsigned int bcolor);             // цвет фона
+void st7735fillrect(int16_t startX, int16_t startY, int16_t stopX, int16_t stopY, unsigned int color);
+// заливка прямоугольника через DMA: функция сразу возвращает управление,
+// done (если не 0) вызывается из прерывания по окончании заливки
+void st7735fillrect_dma(int16_t startX, int16_t startY, int16_t stopX, int16_t stopY, unsigned int color, st7735_cb done);
+// то же, но с ожиданием окончания заливки
+void st7735fillrect_dmawait(int16_t startX, int16_t startY, int16_t stopX, int16_t stopY, unsigned int color);
+// 1 - идёт DMA-передача, SPI занят
+uint8_t st7735dmabusy(void);
+// ожидание окончания DMA-передачи
+void st7735dmawait(void);
+// вертикальная прокрутка, всё в строках памяти кадра (в LANDSCAPE - вдоль X, при MY=1 сверху вниз):
+// top/bottom - неподвижные области, между ними прокручиваемая (не меньше строки, лишнее обрезается).
+// st7735scrolldef(0, 0) - обычный режим
+void st7735scrolldef(unsigned char top, unsigned char bottom);
+// первая показываемая строка прокручиваемой области
+void st7735scrollto(unsigned char row);
+// добавить строку высотой height внизу области (высота области должна делиться на height):
+// старая верхняя строка заливается цветом color и уезжает вниз, возвращается её координата.
+// Высота не делит область или строка не ложится в неё с текущей позиции - ST7735_NOSCROLL, ничего не выводится
+#define ST7735_NOSCROLL 0xFF
+unsigned char st7735scrollline(unsigned char height, unsigned int color);
+// горизонтальный/вертикальный отрезок одной заливкой
+void st7735hline(int16_t x1, int16_t x2, int16_t y, unsigned int color);
+void st7735vline(int16_t x, int16_t y1, int16_t y2, unsigned int color);
+// процедура рисования линии (Брезенхем, точки выводятся отрезками)
+void st7735line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, unsigned int color);
+// прямоугольник (не заполненный)
+void st7735rect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, unsigned int color);
+// окружность и круг
+void st7735circle(int16_t X, int16_t Y, unsigned char R, unsigned int color);
+void st7735fillcircle(int16_t X, int16_t Y, unsigned char R, unsigned int color);
+// прямоугольник со скруглёнными углами радиуса R (x1 < x2, y1 < y2)
+void st7735roundrect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, unsigned char R, unsigned int color);
+void st7735fillroundrect(int16_t x1, int16_t y1, int16_t x2, int16_t y2, unsigned char R, unsigned int color);
+
+// матрица символа по описанию шрифта, 0 - символа в шрифте нет
+const unsigned char *st7735glyph(const st7735_font *f, unsigned char CH);
+// вывод символа по описанию шрифта (любой BITS_*, ширина не больше ST7735_LINEBUF)
+void print_char_font(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor);              // цвет фона
+
+// вывод символа шрифта с ST7735_FONT_BOX: поля вокруг рамки изображения заливаются фоном
+// (margins = 1) или пропускаются (margins = 0 - там уже фон), print_char_font() заливает поля
+void print_char_box(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты знакоместа
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor,               // цвет фона
+                unsigned char margins);            // 1 - залить поля фоном
+
+// вывод символа, увеличенного в scale раз: каждая точка - квадрат scale x scale, матрица
+// не копируется. Один мелкий шрифт на все размеры; BITS_RLE и ST7735_FONT_BOX не увеличиваются
+void print_char_scaled(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты
+                unsigned char scale,               // во сколько раз увеличить
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor);              // цвет фона
+// строка символов, увеличенных в scale раз
+void print_string_scaled(const st7735_font *f, const char *str,
+                unsigned char X, unsigned char Y,  // координаты левого верхнего угла
+                unsigned char scale,               // во сколько раз увеличить
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor);              // цвет фона
+
+// вывод символа через кэш развёрнутых символов (ключ - шрифт, символ, цвета): при попадании
+// окно и одна передача DMA из памяти в SPI, без ожидания окончания. Символы крупнее слота,
+// BITS_RLE и ST7735_FONT_BOX выводятся print_char_font() мимо кэша
+void print_char_cached(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor);              // цвет фона
+// забыть все символы кэша (например, после смены шрифтов)
+void st7735gcacheclear(void);
+
+#if ST7735_BENCH
+// замер раскладки матриц в цвета (конфигурация Bench): такты ядра по SysTick
+typedef struct {
+  uint32_t pixels;    // точек разложено каждым способом
+  uint32_t oldcycles; // побитовый цикл
+  uint32_t newcycles; // полубайтовая таблица
+} st7735_bench_t;
+// все символы шрифта BITS_RB passes раз, на экран ничего не выводится
+void st7735bench_expand(const st7735_font *f, unsigned char passes, st7735_bench_t *res);
+#endif
+
+// вывод сжатого символа (BITS_RLE) прямо в SPI, print_char_font() вызывает его сама
+void print_char_rle(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // координаты
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor);              // цвет фона
+
+// вывод строки по описанию шрифта одним окном и одним RAMWR, до первого символа, которого нет в шрифте
+void print_string_font(const st7735_font *f, const char *str,
+                unsigned char X, unsigned char Y,  // координаты левого верхнего угла
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor);              // цвет фона
+
+// окно шириной W на строку, сдвинутую на offset точек (у левого края окна столбец offset текста,
+// < 0 - слева поле фона): символы по краям режутся посреди матрицы, за концом строки - фон
+void print_string_window(const st7735_font *f, const char *str,
+                unsigned char X, unsigned char Y,  // левый верхний угол окна
+                unsigned char W,                   // ширина окна
+                int16_t offset,                    // столбец текста у левого края окна
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor);              // цвет фона
+// столбцы first..first+count-1 символа, столбец first выводится в точке X
+void print_char_clip(const st7735_font *f, unsigned char CH,
+                unsigned char X, unsigned char Y,  // где окажется столбец first
+                unsigned char first,               // первый видимый столбец матрицы
+                unsigned char count,               // сколько столбцов видно
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor);              // цвет фона
+
+// print_string_font() в системе координат, повёрнутой на rot (ST7735_ROT*): вертикальные надписи
+// без перекладки матриц, поворот после вывода возвращается
+void print_string_rot(const st7735_font *f, const char *str,
+                unsigned char X, unsigned char Y,  // левый верхний угол в повёрнутых координатах
+                uint8_t rot,                       // ST7735_ROT*
+                unsigned int fcolor,               // цвет шрифта
+                unsigned int bcolor);              // цвет фона
+
+// дисплейный список: команды только записываются, экран собирается st7735dl_render() кусками
+// строк по ST7735_LINEBUF точек в буферах DMA драйвера (новой RAM не нужно), и каждая точка
+// уходит в SPI один раз за кадр, сколько бы команд её ни перекрывало. Позже записанная
+// команда рисуется поверх раньше записанных
+#define ST7735_DL_FILL   0 // залитый прямоугольник
+#define ST7735_DL_FRAME  1 // рамка в одну точку
+#define ST7735_DL_TEXT   2 // строка по описанию шрифта (кроме BITS_RLE и ST7735_FONT_BOX)
+#define ST7735_DL_NOBG   0x80 // флаг текста: фона нет, под символами видно то, что ниже
+// таблиц цветов текста на время st7735dl_render() (по 134 байта стека): каждая строится один раз
+// за кадр, пока в одной строке экрана не больше ST7735_DL_LUTS разных сочетаний шрифта и цветов
+#ifndef ST7735_DL_LUTS
+#define ST7735_DL_LUTS   2
+#endif
+typedef struct {
+  const st7735_font *font;   // ST7735_DL_TEXT
+  const unsigned char *str;  // ST7735_DL_TEXT, строка должна жить до st7735dl_render()
+  int16_t  x0, y0, x1, y1;   // занимаемый прямоугольник, края включительно
+  uint16_t fcolor, bcolor;
+  uint8_t  type;             // ST7735_DL_*, у текста может быть | ST7735_DL_NOBG
+  uint8_t  len;              // ST7735_DL_TEXT: символов в строке
+} st7735_dlcmd;
+typedef struct {
+  st7735_dlcmd *cmds;        // массив команд (память пользователя)
+  uint8_t       size;        // его размер
+  uint8_t       count;       // записано команд
+} st7735_dlist;
+void st7735dl_init(st7735_dlist *dl, st7735_dlcmd *cmds, uint8_t size);
+// очистить список (начать новый кадр)
+void st7735dl_clear(st7735_dlist *dl);
+// запись команд, 0 - список полон, команда не записана
+uint8_t st7735dl_fill(st7735_dlist *dl, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+uint8_t st7735dl_frame(st7735_dlist *dl, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+// строка до первого символа, которого нет в шрифте; flags = ST7735_DL_NOBG - без фона
+// (сглаженные шрифты тогда смешиваются с тем, что под ними)
+uint8_t st7735dl_text(st7735_dlist *dl, const st7735_font *f, const char *str, int16_t X, int16_t Y,
+                      uint16_t fcolor, uint16_t bcolor, uint8_t flags);
+// собрать и вывести прямоугольник x0..x1, y0..y1 (с учётом области отсечения) одним окном:
+// точки, не покрытые ни одной командой, - цвета bg
+void st7735dl_render(const st7735_dlist *dl, int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t bg);
+
+// замена символа на экране: выводится только рамка, где матрицы (BITS_RB) старого и нового символа различаются
+void print_glyph_diff(const unsigned char *oldglyph,   // матрица символа, который сейчас на экране
+                const unsigned char *newglyph,         // матрица нового символа
+                unsigned char X, unsigned char Y,      // координаты символа
+                unsigned char SymbolWidth,             // ширина символа (не больше ST7735_LINEBUF)
+                unsigned char SymbolHeight,            // высота символа
+                unsigned int fcolor,                   // цвет шрифта
+                unsigned int bcolor);                  // цвет фона
 
 #endif // __LCD_ST7735SL__
\ No newline at end of file
@@ -1,73 +1,92 @@
+#include <stdio.h>
 #include "main.h"
 #include "myfont.h"
 #include "lcd7735sl.h"
+#include "textgrid.h"
 //#include "consolas_22_font.h"
 //#include "ubuntunums.h"
 #include "fonts/SixteenSegment24x36.h"
 #include "SixteenSegment16x24.h"
 #include "Arial_round_16x24.h"
 #include "consolas_22_font.h"
+#include "consolas_22_rle.h"
 #include "consolas_18_font.h"
+#include "consolas_18_box.h"
 #include "gost_type_a_18_font.h"
+#include "gost_type_a_18_box.h"
+#include "consolas_11_g2.h"
+volatile uint32_t lcdready = 0; // ttms, когда на экране появилась первая заливка
+static uint32_t   lcdreset;     // ttms, когда st7735init_start опустил RST
+
+static void lcd_ready(void)
+{
+  lcdready = ttms;
+}
+
 int main(void) 
 {
   rcc_sysclockinit();
   SysTick_Config(48000); // 1ms if HSI
   gpio_init();
   spi_init();
-  delay_ms(1000);
-  st7735init(LANDSCAPE, CBLUE0);
+  lcdreset = ttms; // RST опускается сразу, в st7735init_start
+  st7735init_start(LANDSCAPE, CBLUE0, lcd_ready); // пока дисплей просыпается, готовим остальное
   
-  //unsigned char x = 32, width = 24, height = 36, lenght = 108;; // SixteenSegment24x36
-  //unsigned char x = 0, width = 16, height = 24, lenght = 48;// SixteenSegment16x24 Arial_round_16x24
-  //unsigned char x =32, width = 15, height = 26, lenght = 52;  // consolas 22
-  //unsigned char x =32, width = 18, height = 34, lenght = 102;  // consolas 22
-  unsigned char x =0, width = 17, height = 23, lenght = 69;  // consolas 22
+  unsigned char x = 0;
   unsigned char X1=8, Y1=8, W1=24;
-  
-  //const unsigned char *Font = SixteenSegment16x24;
-  //const unsigned int  *Fidx = SixteenSegment16x24dx;
-  //const unsigned char *Font = Arial_round_16x24;
-  //const unsigned int  *Fidx = Arial_round_16x24idx;
-  //const unsigned char *Font = font_consolas_18;
-  //const unsigned int  *Fidx = font_consolas_18idx;
-  //const unsigned char *Font = font_consolas_22;
-  //const unsigned int  *Fidx = font_consolas_22idx;
 
-  const unsigned char *Font = font_gost_type_a_18;
-  const unsigned int  *Fidx = font_gost_type_a_18idx;
+  // шрифт целиком описан в своём заголовке: размеры, длина матрицы, порядок бит
+  //static const st7735_font *const gridfonts[] = { &fd_sixteen_segment_24x36 };
+  //static const st7735_font *const gridfonts[] = { &fd_sixteen_segment_16x24 };
+  //static const st7735_font *const gridfonts[] = { &fd_arial_round_16x24 };
+  //static const st7735_font *const gridfonts[] = { &fd_consolas_18 };
+  //static const st7735_font *const gridfonts[] = { &fd_consolas_18_box };      // обрезан по рамке
+  //static const st7735_font *const gridfonts[] = { &fd_consolas_22 };
+  //static const st7735_font *const gridfonts[] = { &fd_consolas_22_rle }; // тот же шрифт, сжатый
+  //static const st7735_font *const gridfonts[] = { &fd_gost_type_a_18_box };  // обрезан по рамке
+  //static const st7735_font *const gridfonts[] = { &fd_consolas_11_g2 };      // сглаженный, 2 бита на точку
+  static const st7735_font *const gridfonts[] = { &fd_gost_type_a_18 };
+
+  // сетка 6 x 3 знакомест: на экран уходят только ячейки, которые действительно изменились
+  static const uint16_t colors[18] = {
+    CORANGE,  CGRAY,    CGREEN0, CGREEN1,  CYELLOW0, CMAGENTA,
+    CPURPLE,  CGREEN2,  CRED,    CGREEN3,  CRED0,    CRUBY,
+    CMAGENTA, CYELLOW0, CGRAY,   CYELLOW1, CGREEN0,  CORANGE,
+  };
+  static tg_cell  cells[18];
+  static textgrid grid;
+  unsigned char i;
+
+  textgrid_init(&grid, cells, 6, 3, X1, Y1, W1, 38, gridfonts);
+  textgrid_invalidate(&grid); // после st7735init экран залит фоном - рисуем всё
 
+  while (!lcdready) {};
+  printf("st7735: first pixel %lu ms after reset\n", (unsigned long)(lcdready - lcdreset));
+#if ST7735_BENCH
+  {
+    // при SPI 24 МГц точка (16 бит) уходит за 32 такта ядра - раскладка должна успевать
+    static const st7735_font *const benchfonts[] = { &fd_arial_round_16x24, &fd_gost_type_a_18 };
+    st7735_bench_t b;
+    for (i = 0; i < 2; i++) {
+      st7735bench_expand(benchfonts[i], 4, &b);
+      printf("expand %ux%u: bit loop %lu.%02lu, nibble lut %lu.%02lu cycles/pixel\n",
+             benchfonts[i]->width, benchfonts[i]->height,
+             (unsigned long)(b.oldcycles / b.pixels), (unsigned long)(b.oldcycles * 100 / b.pixels % 100),
+             (unsigned long)(b.newcycles / b.pixels), (unsigned long)(b.newcycles * 100 / b.pixels % 100));
+    }
+  }
+#endif
 
   do // do main 
   { 
     if (count > ttms || ttms - count > 500) {
       
-      
-      print_char_sl_rb(   x,       X1,    Y1, width, height, lenght, Font, Fidx, CORANGE,  CBLACK); 
-      print_char_sl_rb( x+1,    X1+W1,    Y1, width, height, lenght, Font, Fidx, CGRAY,    CBLACK);
-      print_char_sl_rb( x+2,  X1+W1*2,    Y1, width, height, lenght, Font, Fidx, CGREEN0,  CBLACK); 
-      print_char_sl_rb( x+3,  X1+W1*3,    Y1, width, height, lenght, Font, Fidx, CGREEN1,  CBLACK);
-      print_char_sl_rb( x+4,  X1+W1*4,    Y1, width, height, lenght, Font, Fidx, CYELLOW0, CBLACK); 
-      print_char_sl_rb( x+5,  X1+W1*5,    Y1, width, height, lenght, Font, Fidx, CMAGENTA, CBLACK);
-      
-      print_char_sl_rb( x+6,       X1, Y1+38, width, height, lenght, Font, Fidx, CPURPLE,  CBLACK);
-      print_char_sl_rb( x+7,    X1+W1, Y1+38, width, height, lenght, Font, Fidx, CGREEN2,  CBLACK);
-      print_char_sl_rb( x+8,  X1+W1*2, Y1+38, width, height, lenght, Font, Fidx, CRED,     CBLACK);
-      print_char_sl_rb( x+9,  X1+W1*3, Y1+38, width, height, lenght, Font, Fidx, CGREEN3,  CBLACK);
-      print_char_sl_rb( x+10, X1+W1*4, Y1+38, width, height, lenght, Font, Fidx, CRED0,    CBLACK);
-      print_char_sl_rb( x+11, X1+W1*5, Y1+38, width, height, lenght, Font, Fidx, CRUBY,    CBLACK);
-
-      print_char_sl_rb( x+12,      X1, Y1+76, width, height, lenght, Font, Fidx, CMAGENTA,  CBLACK);
-      print_char_sl_rb( x+13,   X1+W1, Y1+76, width, height, lenght, Font, Fidx, CYELLOW0,  CBLACK);
-      print_char_sl_rb( x+14, X1+W1*2, Y1+76, width, height, lenght, Font, Fidx, CGRAY,     CBLACK);
-      print_char_sl_rb( x+15, X1+W1*3, Y1+76, width, height, lenght, Font, Fidx, CYELLOW1,  CBLACK);
-      print_char_sl_rb( x+16, X1+W1*4, Y1+76, width, height, lenght, Font, Fidx, CGREEN0,   CBLACK);
-      print_char_sl_rb( x+17, X1+W1*5, Y1+76, width, height, lenght, Font, Fidx, CORANGE,   CBLACK);
-
-
+      for (i = 0; i < 18; i++)
+        textgrid_putc(&grid, i % 6, i / 6, gridfonts[0]->first + (x + i) % gridfonts[0]->count, 0, colors[i], CBLACK);
+      textgrid_flush(&grid);
  
       count = ttms;
-      x++; if (x > 222) x = 0;
+      x++; if (x >= gridfonts[0]->count) x = 0;
     }
   } while (1); // main do
 } // main
@@ -0,0 +1,33 @@
+#include "marquee.h"
+
+void marquee_init(marquee *m, const st7735_font *font, const char *text,
+                  unsigned char X, unsigned char Y, unsigned char W, unsigned char speed,
+                  uint16_t fcolor, uint16_t bcolor)
+{
+  m->font   = font;
+  m->X      = X;
+  m->Y      = Y;
+  m->W      = W;
+  m->speed  = speed;
+  m->fcolor = fcolor;
+  m->bcolor = bcolor;
+  marquee_settext(m, text);
+}
+
+void marquee_settext(marquee *m, const char *text)
+{
+  uint16_t len = 0;
+  while (text[len]) len++;
+  m->text  = text;
+  m->width = len * m->font->width;
+  m->pos   = -(int16_t)m->W; // начинаем с пустого окна, текст появится у правого края
+}
+
+uint8_t marquee_step(marquee *m)
+{
+  print_string_window(m->font, m->text, m->X, m->Y, m->W, m->pos, m->fcolor, m->bcolor);
+  m->pos += m->speed;
+  if (m->pos < m->width) return 0;
+  m->pos = -(int16_t)m->W;
+  return 1;
+}
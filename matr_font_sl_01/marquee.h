@@ -0,0 +1,29 @@
+#pragma once
+#ifndef __MARQUEE_H__
+#define __MARQUEE_H__
+#include "lcd7735sl.h"
+
+// Бегущая строка в окне: текст въезжает справа и уходит влево с шагом в speed точек.
+// Каждый шаг - одно окно print_string_window(): уходят только видимые столбцы,
+// крайние символы режутся посреди матрицы, поэтому движение плавное, а не по знакоместам.
+
+typedef struct {
+  const st7735_font *font;
+  const char    *text;     // строка не копируется - должна жить, пока идёт прокрутка
+  int16_t        width;    // ширина текста в точках
+  int16_t        pos;      // столбец текста у левого края окна (< 0 - текст ещё не дошёл до края)
+  unsigned char  X, Y, W;  // окно: левый верхний угол и ширина, высота - высота шрифта
+  unsigned char  speed;    // точек за шаг
+  uint16_t       fcolor, bcolor;
+} marquee;
+
+void marquee_init(marquee *m, const st7735_font *font, const char *text,
+                  unsigned char X, unsigned char Y, unsigned char W, unsigned char speed,
+                  uint16_t fcolor, uint16_t bcolor);
+// новый текст, прокрутка начинается заново
+void marquee_settext(marquee *m, const char *text);
+// вывести окно и сдвинуть текст на speed точек; 1 - текст целиком ушёл, начинаем заново.
+// Вызывать по таймеру: скорость в точках/с = speed * частота вызова
+uint8_t marquee_step(marquee *m);
+
+#endif // __MARQUEE_H__
@@ -1,279 +1,38 @@
-// inconsola24x32[]
-const unsigned char InconsolaNum24x32[] = {
-// 480 / 5 =  96    В строке 96 байт
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // <space>
-0x00,0x10,0x00,0x00,0xFC,0x00,0x01,0xFE,0x00,0x03,0xC7,0x00,0x03,0x83,0x80,0x07,0x01,0x80,0x06,0x01,0xC0,0x06,0x03,0xC0,0x0E,0x07,0xC0,0x0E,0x0E,0xC0,0x0E,0x1C,0xE0,0x0C,0x18,0xE0,0x0C,0x38,0xE0,0x0E,0x70,0xE0,0x0E,0xE0,0xE0,0x0E,0xC0,0xC0,0x0F,0xC0,0xC0,0x07,0x80,0xC0,0x07,0x01,0xC0,0x07,0x01,0x80,0x03,0x83,0x80,0x03,0xC7,0x00,0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 0   96
-0x00,0x00,0x00,0x00,0x0E,0x00,0x00,0x3E,0x00,0x01,0xFE,0x00,0x00,0xC6,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 1
-0x00,0x10,0x00,0x00,0xFE,0x00,0x01,0xFF,0x00,0x03,0x87,0x80,0x07,0x01,0xC0,0x02,0x01,0xC0,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x20,0x07,0xFF,0xC0,0x07,0xFF,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 2
-0x00,0x00,0x00,0x00,0xFC,0x00,0x03,0xFF,0x00,0x07,0x07,0x00,0x02,0x03,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x01,0x80,0x00,0x03,0x80,0x00,0x07,0x00,0x00,0x1E,0x00,0x00,0x7C,0x00,0x00,0x7F,0x00,0x00,0x07,0x80,0x00,0x03,0x80,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x02,0x01,0xC0,0x02,0x03,0x80,0x07,0x87,0x80,0x03,0xFF,0x00,0x01,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 3
-0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3F,0x00,0x00,0x37,0x00,0x00,0x67,0x00,0x00,0x67,0x00,0x00,0xC7,0x00,0x01,0xC7,0x00,0x01,0x87,0x00,0x03,0x07,0x00,0x07,0x07,0x00,0x06,0x07,0x00,0x0F,0xFF,0xE0,0x0F,0xFF,0xE0,0x0F,0xFF,0xE0,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 4
-0x00,0x00,0x00,0x03,0xFF,0xC0,0x03,0xFF,0xC0,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0xFE,0x00,0x07,0xFF,0x00,0x07,0x87,0x80,0x07,0x01,0xC0,0x00,0x01,0xC0,0x00,0x00,0xC0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xC0,0x02,0x01,0xC0,0x0E,0x01,0xC0,0x07,0x87,0x80,0x03,0xFF,0x00,0x01,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 5
-0x00,0x08,0x00,0x00,0x7F,0x00,0x00,0xFF,0xC0,0x01,0xC1,0x80,0x03,0x80,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x06,0x00,0x00,0x06,0x3E,0x00,0x06,0xFF,0x00,0x07,0xC7,0x80,0x07,0x81,0x80,0x07,0x01,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x07,0x00,0xC0,0x03,0x01,0xC0,0x03,0x81,0xC0,0x01,0xC3,0x80,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 6
-0x00,0x00,0x00,0x07,0xFF,0xC0,0x07,0xFF,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x00,0x03,0x80,0x00,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x01,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 7
-0x00,0x18,0x00,0x00,0xFE,0x00,0x01,0xFF,0x00,0x03,0x83,0x80,0x03,0x01,0x80,0x07,0x01,0xC0,0x07,0x01,0xC0,0x03,0x01,0xC0,0x03,0x83,0x80,0x01,0xC7,0x00,0x00,0xFE,0x00,0x00,0x7C,0x00,0x01,0xFF,0x00,0x03,0xC7,0x80,0x07,0x03,0x80,0x07,0x01,0xC0,0x06,0x00,0xC0,0x0E,0x00,0xE0,0x0E,0x00,0xC0,0x06,0x00,0xC0,0x07,0x01,0xC0,0x07,0x83,0x80,0x03,0xFF,0x80,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 8
-0x00,0x10,0x00,0x00,0xFE,0x00,0x01,0xFF,0x00,0x03,0x87,0x80,0x07,0x03,0x80,0x07,0x01,0xC0,0x06,0x01,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x06,0x00,0xC0,0x07,0x00,0xC0,0x07,0x01,0xC0,0x03,0x83,0xC0,0x03,0xFE,0xC0,0x00,0xFC,0xC0,0x00,0x20,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x01,0xC0,0x00,0x03,0x80,0x02,0x03,0x80,0x03,0x0F,0x00,0x07,0xFE,0x00,0x01,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 9
+// myfont (из myfont.h), матрицы построчно, младший бит - левая точка (BITS_RB)
+// 1344 байт матриц + 82 байт смещений вместо 3936, сгенерировано tools/fontc
 
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // :
-0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0C,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // .
-0x00,0x20,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0xFC,0x00,0x00,0xCC,0x00,0x00,0xCE,0x00,0x01,0x86,0x00,0x01,0x86,0x00,0x01,0x87,0x00,0x03,0x03,0x00,0x03,0x03,0x80,0x03,0xFF,0x80,0x07,0xFF,0x80,0x06,0x01,0xC0,0x0E,0x01,0xC0,0x0E,0x00,0xC0,0x0C,0x00,0xE0,0x1C,0x00,0xE0,0x1C,0x00,0x70,0x18,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // A
-0x00,0x00,0x00,0x1C,0x00,0x70,0x0C,0x00,0x60,0x0E,0x00,0xE0,0x0E,0x00,0xE0,0x06,0x00,0xC0,0x07,0x01,0xC0,0x07,0x01,0xC0,0x03,0x01,0x80,0x03,0x81,0x80,0x03,0x83,0x80,0x01,0x83,0x00,0x01,0xC3,0x00,0x01,0xC7,0x00,0x00,0xC6,0x00,0x00,0xE6,0x00,0x00,0xEE,0x00,0x00,0x6C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // V
+#ifndef FONT_INCONSOLA_NUM_24X32_H
+#define FONT_INCONSOLA_NUM_24X32_H
+
+#include "lcd7735sl.h"
+
+const unsigned char font_inconsola_num_24x32[1344] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 46 <.>
+    0x00, 0x08, 0x00, 0x00, 0x3F, 0x00, 0x80, 0x7F, 0x00, 0xC0, 0xE3, 0x00, 0xC0, 0xC1, 0x01, 0xE0, 0x80, 0x01, 0x60, 0x80, 0x03, 0x60, 0xC0, 0x03, 0x70, 0xE0, 0x03, 0x70, 0x70, 0x03, 0x70, 0x38, 0x07, 0x30, 0x18, 0x07, 0x30, 0x1C, 0x07, 0x70, 0x0E, 0x07, 0x70, 0x07, 0x07, 0x70, 0x03, 0x03, 0xF0, 0x03, 0x03, 0xE0, 0x01, 0x03, 0xE0, 0x80, 0x03, 0xE0, 0x80, 0x01, 0xC0, 0xC1, 0x01, 0xC0, 0xE3, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 48 <0>
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x7C, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x63, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 49 <1>
+    0x00, 0x08, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0xE1, 0x01, 0xE0, 0x80, 0x03, 0x40, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x00, 0x04, 0xE0, 0xFF, 0x03, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 50 <2>
+    0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0xC0, 0xFF, 0x00, 0xE0, 0xE0, 0x00, 0x40, 0xC0, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0x80, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xE0, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3E, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xE0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x40, 0x80, 0x03, 0x40, 0xC0, 0x01, 0xE0, 0xE1, 0x01, 0xC0, 0xFF, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 51 <3>
+    0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0xF8, 0x00, 0x00, 0xFC, 0x00, 0x00, 0xEC, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xE6, 0x00, 0x00, 0xE3, 0x00, 0x80, 0xE3, 0x00, 0x80, 0xE1, 0x00, 0xC0, 0xE0, 0x00, 0xE0, 0xE0, 0x00, 0x60, 0xE0, 0x00, 0xF0, 0xFF, 0x07, 0xF0, 0xFF, 0x07, 0xF0, 0xFF, 0x07, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 52 <4>
+    0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0xC0, 0xFF, 0x03, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xE0, 0xFF, 0x00, 0xE0, 0xE1, 0x01, 0xE0, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x03, 0x40, 0x80, 0x03, 0x70, 0x80, 0x03, 0xE0, 0xE1, 0x01, 0xC0, 0xFF, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 53 <5>
+    0x00, 0x10, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x03, 0x80, 0x83, 0x01, 0xC0, 0x01, 0x01, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x7C, 0x00, 0x60, 0xFF, 0x00, 0xE0, 0xE3, 0x01, 0xE0, 0x81, 0x01, 0xE0, 0x80, 0x03, 0x60, 0x00, 0x03, 0x60, 0x00, 0x03, 0x60, 0x00, 0x03, 0x60, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xC0, 0x80, 0x03, 0xC0, 0x81, 0x03, 0x80, 0xC3, 0x01, 0x00, 0xFF, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 54 <6>
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xE0, 0xFF, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x01, 0x00, 0xC0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00, 0x38, 0x00, 0x00, 0x38, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 55 <7>
+    0x00, 0x18, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0xC1, 0x01, 0xC0, 0x80, 0x01, 0xE0, 0x80, 0x03, 0xE0, 0x80, 0x03, 0xC0, 0x80, 0x03, 0xC0, 0xC1, 0x01, 0x80, 0xE3, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x3E, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0xE3, 0x01, 0xE0, 0xC0, 0x01, 0xE0, 0x80, 0x03, 0x60, 0x00, 0x03, 0x70, 0x00, 0x07, 0x70, 0x00, 0x03, 0x60, 0x00, 0x03, 0xE0, 0x80, 0x03, 0xE0, 0xC1, 0x01, 0xC0, 0xFF, 0x01, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 56 <8>
+    0x00, 0x08, 0x00, 0x00, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0xE1, 0x01, 0xE0, 0xC0, 0x01, 0xE0, 0x80, 0x03, 0x60, 0x80, 0x03, 0x60, 0x00, 0x03, 0x60, 0x00, 0x03, 0x60, 0x00, 0x03, 0xE0, 0x00, 0x03, 0xE0, 0x80, 0x03, 0xC0, 0xC1, 0x03, 0xC0, 0x7F, 0x03, 0x00, 0x3F, 0x03, 0x00, 0x04, 0x03, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0xC0, 0x01, 0x40, 0xC0, 0x01, 0xC0, 0xF0, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 57 <9>
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 58 <:>
+    0x00, 0x04, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x33, 0x00, 0x00, 0x73, 0x00, 0x80, 0x61, 0x00, 0x80, 0x61, 0x00, 0x80, 0xE1, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x01, 0xC0, 0xFF, 0x01, 0xE0, 0xFF, 0x01, 0x60, 0x80, 0x03, 0x70, 0x80, 0x03, 0x70, 0x00, 0x03, 0x30, 0x00, 0x07, 0x38, 0x00, 0x07, 0x38, 0x00, 0x0E, 0x18, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // Символ 65 <A>
+    0x00, 0x00, 0x00, 0x38, 0x00, 0x0E, 0x30, 0x00, 0x06, 0x70, 0x00, 0x07, 0x70, 0x00, 0x07, 0x60, 0x00, 0x03, 0xE0, 0x80, 0x03, 0xE0, 0x80, 0x03, 0xC0, 0x80, 0x01, 0xC0, 0x81, 0x01, 0xC0, 0xC1, 0x01, 0x80, 0xC1, 0x00, 0x80, 0xC3, 0x00, 0x80, 0xE3, 0x00, 0x00, 0x63, 0x00, 0x00, 0x67, 0x00, 0x00, 0x77, 0x00, 0x00, 0x36, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00   // Символ 86 <V>
+};
+
+// смещения матриц символов 46..86, ST7735_NOGLYPH - символа нет
+const uint16_t font_inconsola_num_24x32idx[41] =
+{
+        0, ST7735_NOGLYPH,    96,   192,   288,   384,   480,   576,   672,   768,   864,   960,  1056, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH,
+    ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH,  1152, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH,
+    ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH, ST7735_NOGLYPH,  1248
 };
 
+// описание шрифта для print_char_font()
+const st7735_font fd_inconsola_num_24x32 = { font_inconsola_num_24x32, font_inconsola_num_24x32idx, 96, 24, 32, 46, 41, BITS_RB, 0 };
 
-const unsigned int InconsolaNum24x32index[255] = {
-0, //   0
-0, //   1
-0, //   2
-0, //   3
-0, //   4
-0, //   5
-0, //   6
-0, //   7
-0, //   8
-0, //   9
-0, //  10
-0, //  11
-0, //  12
-0, //  13
-0, //  14
-0, //  15
-0, //  16
-0, //  17
-0, //  18
-0, //  19
-0, //  20
-0, //  21
-0, //  22
-0, //  23
-0, //  24
-0, //  25
-0, //  26
-0, //  27
-0, //  28
-0, //  29
-0, //  30
-0, //  31
-0, //  space (32)
-0, //  33 '!'
-0, //  34
-0, //  35
-0, //  36
-0, //  37
-0, //  38
-0, //  39
-0, //  40
-0, //  41
-0, //  42
-0, //  43
-0, //  44
-0, //  45
-1152, //  46 '.'
-0, //  47
-  96, //  48 '0'
- 192, //  49 '1'
- 288, //  50 '2'
- 384, //  51 '3'
- 480, //  52 '4'
- 576, //  53 '5'
- 672, //  54 '6'
- 768, //  55 '7'
- 864, //  56 '8'
- 960, //  57 '9'
-1056, //  58 ':'
-0, //  59
-0, //  60
-0, //  61
-0, //  62
-0, //  63
-0, //  64
-1152, //  65 'A'
-0, //  66
-0, //  67
-0, //  68
-0, //  69
-0, //  70
-0, //  71
-0, //  72
-0, //  73
-0, //  74
-0, //  75
-0, //  76
-0, //  77
-0, //  78
-0, //  79
-0, //  80
-0, //  81
-0, //  82
-0, //  83
-0, //  84
-0, //  85
-1248, //  86 'V'
-0, //  87
-0, //  88
-0, //  89
-0, //  90
-0, //  91
-0, //  92
-0, //  93
-0, //  94
-0, //  95
-0, //  96
-0, //  97
-0, //  98
-0, //  99
-0, // 100
-0, // 101
-0, // 102
-0, // 103
-0, // 104
-0, // 105
-0, // 106
-0, // 107
-0, // 108
-0, // 109
-0, // 110
-0, // 111
-0, // 112
-0, // 113
-0, // 114
-0, // 115
-0, // 116
-0, // 117
-0, // 118
-0, // 119
-0, // 120
-0, // 121
-0, // 122
-0, // 123
-0, // 124
-0, // 125
-0, // 126
-0, // 127
-0, // 128
-0, // 129
-0, // 130
-0, // 131
-0, // 132
-0, // 133
-0, // 134
-0, // 135
-0, // 136
-0, // 137
-0, // 138
-0, // 139
-0, // 140
-0, // 141
-0, // 142
-0, // 143
-0, // 144
-0, // 145
-0, // 146
-0, // 147
-0, // 148
-0, // 149
-0, // 150
-0, // 151
-0, // 152
-0, // 153
-0, // 154
-0, // 155
-0, // 156
-0, // 157
-0, // 158
-0, // 159
-0, // 160
-0, // 161
-0, // 162
-0, // 163
-0, // 164
-0, // 165
-0, // 166
-0, // 167
-0, // 168
-0, // 169
-0, // 150
-0, // 171
-0, // 172
-0, // 173
-0, // 174
-0, // 175
-0, // 176
-0, // 177
-0, // 178
-0, // 179
-0, // 180
-0, // 181
-0, // 182
-0, // 183
-0, // 184
-0, // 185
-0, // 186
-0, // 187
-0, // 188
-0, // 189
-0, // 190
-0, // 191
-0, // 192
-0, // 193
-0, // 194
-0, // 195
-0, // 196
-0, // 197
-0, // 198
-0, // 199
-0, // 200
-0, // 201
-0, // 202
-0, // 203
-0, // 204
-0, // 205
-0, // 206
-0, // 207
-0, // 208
-0, // 209
-0, // 210
-0, // 211
-0, // 212
-0, // 213
-0, // 214
-0, // 215
-0, // 216
-0, // 217
-0, // 218
-0, // 219
-0, // 220
-0, // 221
-0, // 222
-0, // 223
-0, // 224
-0, // 225
-0, // 226
-0, // 227
-0, // 228
-0, // 229
-0, // 230
-0, // 231
-0, // 232
-0, // 233
-0, // 234
-0, // 235
-0, // 236
-0, // 237
-0, // 238
-0, // 239
-0, // 240
-0, // 241
-0, // 242
-0, // 243
-0, // 244
-0, // 245
-0, // 246
-0, // 247
-0, // 248
-0, // 249
-0, // 250
-0, // 251
-0, // 252
-0, // 253
-0, // 254
-};
\ No newline at end of file
+#endif // FONT_INCONSOLA_NUM_24X32_H
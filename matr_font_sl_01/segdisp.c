@@ -0,0 +1,153 @@
+#include "segdisp.h"
+
+// цифры 0..9
+static const uint8_t sd_digits[10] = { 0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F };
+
+void segdisp_style(sd_style *style, unsigned char w, unsigned char h, unsigned char t)
+{
+  unsigned char hh, lh, ly;
+  sd_rect *s = style->seg;
+
+  // у каждого сегмента должна остаться хотя бы точка: цифра не меньше 3 x 5,
+  // толщина не больше (w - 1) / 2 и (h - 2) / 3
+  if (w < 3) w = 3;
+  if (h < 5) h = 5;
+  if (t > (w - 1) / 2) t = (w - 1) / 2;
+  if (t > (h - 2) / 3) t = (h - 2) / 3;
+  if (t == 0)          t = 1;
+  hh = (h - 3 * t) / 2;                   // высота верхних вертикальных сегментов
+  lh = h - 3 * t - hh;                    // нижних (при нечётной высоте на точку больше)
+  ly = 2 * t + hh;                        // начало нижних вертикальных
+
+  // горизонтальные между углами, вертикальные между горизонтальными: углы t x t пустые,
+  // сегменты не касаются друг друга сторонами
+  s[0] = (sd_rect){ t,     0,      w - 2 * t, t  }; // a
+  s[1] = (sd_rect){ w - t, t,      t,         hh }; // b
+  s[2] = (sd_rect){ w - t, ly,     t,         lh }; // c
+  s[3] = (sd_rect){ t,     h - t,  w - 2 * t, t  }; // d
+  s[4] = (sd_rect){ 0,     ly,     t,         lh }; // e
+  s[5] = (sd_rect){ 0,     t,      t,         hh }; // f
+  s[6] = (sd_rect){ t,     t + hh, w - 2 * t, t  }; // g
+  s[7] = (sd_rect){ w + 1, h - t,  t,         t  }; // dp
+  style->step   = w + t + 2;
+  style->height = h;
+}
+
+uint8_t segdisp_mask(char ch)
+{
+  if (ch >= '0' && ch <= '9') return sd_digits[ch - '0'];
+  switch (ch) {
+    case 'A': case 'a': return 0x77;
+    case 'B': case 'b': return 0x7C;
+    case 'C':           return 0x39;
+    case 'c':           return 0x58;
+    case 'D': case 'd': return 0x5E;
+    case 'E': case 'e': return 0x79;
+    case 'F': case 'f': return 0x71;
+    case 'H':           return 0x76;
+    case 'h':           return 0x74;
+    case 'L': case 'l': return 0x38;
+    case 'n':           return 0x54;
+    case 'O':           return 0x3F;
+    case 'o':           return 0x5C;
+    case 'P': case 'p': return 0x73;
+    case 'r':           return 0x50;
+    case 't':           return 0x78;
+    case 'U':           return 0x3E;
+    case 'u':           return 0x1C;
+    case '-':           return SD_G;
+    case '_':           return SD_D;
+    default:            return 0;
+  }
+}
+
+void segdisp_init(segdisp *d, uint8_t *masks, unsigned char count, unsigned char X, unsigned char Y,
+                  const sd_style *style, uint16_t on, uint16_t off)
+{
+  unsigned char i;
+  if (count > SD_MAXDIGITS) count = SD_MAXDIGITS;
+  d->X     = X;
+  d->Y     = Y;
+  d->count = count;
+  d->style = style;
+  d->masks = masks;
+  d->on    = on;
+  d->off   = off;
+  d->valid = 0;
+  for (i = 0; i < count; i++) masks[i] = 0;
+}
+
+void segdisp_colors(segdisp *d, uint16_t on, uint16_t off)
+{
+  if (d->on == on && d->off == off) return;
+  d->on    = on;
+  d->off   = off;
+  d->valid = 0;
+}
+
+void segdisp_invalidate(segdisp *d)
+{
+  d->valid = 0;
+}
+
+// новые маски всех цифр: на экран - только разница с тем, что уже горит
+static unsigned char segdisp_apply(segdisp *d, const uint8_t *masks)
+{
+  unsigned char i, drawn = 0;
+  for (i = 0; i < d->count; i++) drawn += segdisp_set(d, i, masks[i]);
+  return drawn;
+}
+
+unsigned char segdisp_set(segdisp *d, unsigned char pos, uint8_t mask)
+{
+  const sd_rect *s = d->style->seg;
+  unsigned char X, k, drawn = 0;
+  uint8_t changed;
+
+  if (pos >= d->count) return 0;
+  changed = ((d->valid >> pos) & 1) ? (uint8_t)(d->masks[pos] ^ mask) : 0xFF; // цифра не известна - все сегменты
+  X = d->X + pos * d->style->step;
+  for (k = 0; k < 8; k++, s++)
+    if ((changed >> k) & 1) {
+      st7735fillrect_dma(X + s->x, d->Y + s->y, X + s->x + s->w - 1, d->Y + s->y + s->h - 1,
+                         ((mask >> k) & 1) ? d->on : d->off, 0);
+      drawn++;
+    }
+  d->masks[pos] = mask;
+  d->valid     |= 1 << pos; // цифра нарисована целиком
+  return drawn;
+}
+
+unsigned char segdisp_puts(segdisp *d, const char *str)
+{
+  uint8_t masks[SD_MAXDIGITS];
+  unsigned char n = 0, i;
+
+  for (i = 0; i < d->count; i++) masks[i] = 0;
+  for (; *str; str++) {
+    if (*str == '.' && n > 0 && !(masks[n - 1] & SD_DP)) { masks[n - 1] |= SD_DP; continue; }
+    if (n == d->count) break;
+    masks[n++] = (*str == '.') ? SD_DP : segdisp_mask(*str);
+  }
+  return segdisp_apply(d, masks);
+}
+
+unsigned char segdisp_number(segdisp *d, int32_t value)
+{
+  uint8_t  masks[SD_MAXDIGITS];
+  uint32_t v = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+  unsigned char i = d->count, n;
+
+  for (n = 0; n < d->count; n++) masks[n] = 0;
+  do {
+    if (i == 0) break;
+    masks[--i] = sd_digits[v % 10];
+    v /= 10;
+  } while (v);
+  if (value < 0) {
+    if (i == 0) v = 1; // под минус места нет
+    else        masks[--i] = SD_G;
+  }
+  if (v) for (n = 0; n < d->count; n++) masks[n] = SD_G; // переполнение
+  return segdisp_apply(d, masks);
+}
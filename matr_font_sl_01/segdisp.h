@@ -0,0 +1,59 @@
+#pragma once
+#ifndef __SEGDISP_H__
+#define __SEGDISP_H__
+#include "lcd7735sl.h"
+
+// Семисегментный индикатор без шрифта: каждый сегмент - прямоугольник, рисуется заливкой окна.
+// На экране хранится маска горящих сегментов, при смене значения заливаются только сегменты,
+// которые зажглись (цвет on) или погасли (цвет off) - у счётчика это несколько мелких заливок.
+
+#define SD_A  0x01 // верхний
+#define SD_B  0x02 // правый верхний
+#define SD_C  0x04 // правый нижний
+#define SD_D  0x08 // нижний
+#define SD_E  0x10 // левый нижний
+#define SD_F  0x20 // левый верхний
+#define SD_G  0x40 // средний
+#define SD_DP 0x80 // точка справа внизу
+
+#define SD_MAXDIGITS 11 // цифр в одном индикаторе не больше: int32_t со знаком
+
+// прямоугольник сегмента относительно левого верхнего угла цифры
+typedef struct {
+  uint8_t x, y, w, h;
+} sd_rect;
+
+// начертание: сегменты a..g, dp и шаг цифр, 34 байта
+typedef struct {
+  sd_rect seg[8];
+  uint8_t step;    // шаг цифр по X
+  uint8_t height;  // высота цифры
+} sd_style;
+
+typedef struct {
+  unsigned char   X, Y;    // левый верхний угол первой цифры
+  unsigned char   count;   // число цифр
+  uint16_t        valid;   // бит на цифру: 0 - что на экране, не известно, следующий вывод рисует все её сегменты
+  uint16_t        on, off; // цвета горящего и погасшего сегмента (off - обычно фон или тусклый)
+  const sd_style *style;
+  uint8_t        *masks;   // count масок сегментов, которые сейчас на экране; память выделяет вызывающий
+} segdisp;
+
+// начертание цифры w x h точек с толщиной сегмента t, точка - квадрат t x t справа от цифры.
+// Толщина, при которой сегменты не помещаются, уменьшается
+void segdisp_style(sd_style *style, unsigned char w, unsigned char h, unsigned char t);
+// маска сегментов символа: цифры, A-F, часть латиницы, '-', '_', пробел; неизвестные - пусто
+uint8_t segdisp_mask(char ch);
+void segdisp_init(segdisp *d, uint8_t *masks, unsigned char count, unsigned char X, unsigned char Y,
+                  const sd_style *style, uint16_t on, uint16_t off);
+// цвета сменились или экран очищен - следующий вывод рисует все сегменты
+void segdisp_colors(segdisp *d, uint16_t on, uint16_t off);
+void segdisp_invalidate(segdisp *d);
+// зажечь в цифре pos сегменты mask, возвращает число залитых сегментов
+unsigned char segdisp_set(segdisp *d, unsigned char pos, uint8_t mask);
+// строка слева направо, '.' зажигает точку предыдущей цифры; лишнее обрезается, недостающее гаснет
+unsigned char segdisp_puts(segdisp *d, const char *str);
+// целое число, прижатое вправо; не влезает - горят только средние сегменты
+unsigned char segdisp_number(segdisp *d, int32_t value);
+
+#endif // __SEGDISP_H__
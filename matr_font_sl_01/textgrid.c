@@ -0,0 +1,84 @@
+#include "textgrid.h"
+
+void textgrid_init(textgrid *grid, tg_cell *cells, unsigned char cols, unsigned char rows,
+                   unsigned char X, unsigned char Y, unsigned char stepX, unsigned char stepY,
+                   const st7735_font *const *fonts)
+{
+  unsigned int i;
+  grid->X     = X;
+  grid->Y     = Y;
+  grid->cols  = cols;
+  grid->rows  = rows;
+  grid->stepX = stepX;
+  grid->stepY = stepY;
+  grid->fonts = fonts;
+  grid->cells = cells;
+  for (i = 0; i < (unsigned int)cols * rows; i++) {
+    cells[i].ch     = ' ';
+    cells[i].font   = TG_DIRTY;
+    cells[i].fcolor = 0;
+    cells[i].bcolor = 0;
+    cells[i].prev   = ' ';
+  }
+}
+
+void textgrid_invalidate(textgrid *grid)
+{
+  unsigned int i;
+  for (i = 0; i < (unsigned int)grid->cols * grid->rows; i++)
+    grid->cells[i].font = (grid->cells[i].font & TG_FONT) | TG_DIRTY; // экран не известен - только целиком
+}
+
+void textgrid_putc(textgrid *grid, unsigned char col, unsigned char row, unsigned char ch,
+                   uint8_t font, uint16_t fcolor, uint16_t bcolor)
+{
+  tg_cell *cell;
+  if (col >= grid->cols || row >= grid->rows) return;
+  cell = &grid->cells[row * grid->cols + col];
+  if ((cell->font & TG_FONT) == font && cell->fcolor == fcolor && cell->bcolor == bcolor) {
+    if (cell->ch == ch) return; // на экране уже это
+    if (!(cell->font & TG_DIRTY)) { // сменился только символ: хватит перерисовать отличия
+      cell->prev  = cell->ch;
+      cell->font |= TG_DIRTY | TG_DIFF;
+    }
+    cell->ch = ch;
+    return;
+  }
+  cell->ch     = ch;
+  cell->font   = font | TG_DIRTY;
+  cell->fcolor = fcolor;
+  cell->bcolor = bcolor;
+}
+
+void textgrid_puts(textgrid *grid, unsigned char col, unsigned char row, const char *str,
+                   uint8_t font, uint16_t fcolor, uint16_t bcolor)
+{
+  while (*str && col < grid->cols) textgrid_putc(grid, col++, row, (unsigned char)*str++, font, fcolor, bcolor);
+}
+
+unsigned int textgrid_flush(textgrid *grid)
+{
+  unsigned int  drawn = 0;
+  unsigned char col, row, X, Y;
+  tg_cell      *cell = grid->cells;
+  const st7735_font   *f;
+  const unsigned char *a, *b;
+
+  for (row = 0; row < grid->rows; row++)
+    for (col = 0; col < grid->cols; col++, cell++) {
+      if (!(cell->font & TG_DIRTY)) continue;
+      f = grid->fonts[cell->font & TG_FONT];
+      X = grid->X + col * grid->stepX;
+      Y = grid->Y + row * grid->stepY;
+      a = st7735glyph(f, cell->prev);
+      b = st7735glyph(f, cell->ch);
+      // отличия умеем искать только в однобитных матрицах полного размера
+      if ((cell->font & TG_DIFF) && a && b && f->bitorder == BITS_RB && !(f->flags & ST7735_FONT_BOX))
+        print_glyph_diff(a, b, X, Y, f->width, f->height, cell->fcolor, cell->bcolor);
+      else
+        print_char_cached(f, cell->ch, X, Y, cell->fcolor, cell->bcolor);
+      cell->font &= TG_FONT;
+      drawn++;
+    }
+  return drawn;
+}
@@ -0,0 +1,44 @@
+#pragma once
+#ifndef __TEXTGRID_H__
+#define __TEXTGRID_H__
+#include "lcd7735sl.h"
+
+// Сетка знакомест поверх print_char_font(): для каждой ячейки хранится то, что в ней
+// должно быть (символ, цвета, шрифт), и на дисплей уходят только изменившиеся ячейки.
+
+#define TG_DIRTY 0x80 // флаг в tg_cell.font: ячейку нужно перерисовать
+#define TG_DIFF  0x40 // флаг в tg_cell.font: сменился только символ - выводим лишь отличия от prev
+#define TG_FONT  0x3F // номер шрифта в tg_cell.font
+
+// ячейка сетки, 8 байт
+typedef struct {
+  uint8_t  ch;     // код символа
+  uint8_t  font;   // номер шрифта в таблице сетки | TG_DIRTY | TG_DIFF
+  uint16_t fcolor; // цвет символа
+  uint16_t bcolor; // цвет фона
+  uint8_t  prev;   // символ, который сейчас на экране (для TG_DIFF)
+} tg_cell;
+
+typedef struct {
+  unsigned char  X, Y;         // левый верхний угол сетки
+  unsigned char  cols, rows;   // размер сетки в знакоместах
+  unsigned char  stepX, stepY; // шаг знакомест в точках
+  const st7735_font *const *fonts; // таблица шрифтов
+  tg_cell       *cells;        // cols * rows ячеек, память выделяет вызывающий
+} textgrid;
+
+void textgrid_init(textgrid *grid, tg_cell *cells, unsigned char cols, unsigned char rows,
+                   unsigned char X, unsigned char Y, unsigned char stepX, unsigned char stepY,
+                   const st7735_font *const *fonts);
+// пометить все ячейки для перерисовки (после st7735init или очистки экрана)
+void textgrid_invalidate(textgrid *grid);
+// записать символ в ячейку; если ничего не изменилось - ячейка не помечается
+void textgrid_putc(textgrid *grid, unsigned char col, unsigned char row, unsigned char ch,
+                   uint8_t font, uint16_t fcolor, uint16_t bcolor);
+// записать строку начиная с ячейки (col, row), лишнее обрезается по краю сетки
+void textgrid_puts(textgrid *grid, unsigned char col, unsigned char row, const char *str,
+                   uint8_t font, uint16_t fcolor, uint16_t bcolor);
+// вывести помеченные ячейки, возвращает число перерисованных
+unsigned int textgrid_flush(textgrid *grid);
+
+#endif // __TEXTGRID_H__
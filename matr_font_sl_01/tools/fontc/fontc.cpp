@@ -0,0 +1,457 @@
+// fontc - компилятор шрифтов для lcd7735sl.
+// Читает проекты matrixFont (.RHF), заголовки matrixFont и UTFT, заголовки с описанием
+// st7735_font (в том числе свои же, поэтому шрифт можно пересобирать на месте), самодельные массивы и пишет
+// заголовок в одном формате: строки матрицы по байтам, младший бит - левая точка (BITS_RB),
+// плюс описание st7735_font. Прошивке остаётся один путь вывода, развороты бит не нужны.
+// Сглаженные шрифты (BITS_G2/BITS_G4) получаются уменьшением однобитного в -x раз:
+// уровень точки - доля закрашенных точек в её квадрате x на x.
+//
+// Сборка и запуск на хосте: make && ./fontc [опции] вход > выход.h
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+enum Bits { BITS_FB, BITS_RB, BITS_VRB };
+enum Format { FMT_RAW, FMT_BOX, FMT_RLE, FMT_G2, FMT_G4 };
+
+// символ: уровни точек 0..Font::max построчно, width * height
+using Glyph = std::vector<uint8_t>;
+
+struct Font {
+  std::string        title;          // название для комментария
+  std::string        include = "lcd7735sl.h"; // путь в #include выхода
+  int                width  = 0;
+  int                height = 0;
+  int                max    = 1;     // уровень закрашенной точки (после -x - x * x)
+  std::vector<int>   codes;          // код каждого символа
+  std::vector<Glyph> glyphs;
+};
+
+struct Options {
+  std::string name;                  // имя в выходе: font_<name>, fd_<name>
+  std::string array;                 // имя массива во входном .h
+  std::string map;                   // коды символов по порядку матриц во входе
+  int         width  = 0;
+  int         height = 0;
+  int         first  = -1;
+  int         bits   = -1;
+  int         lo = 0, hi = 255;      // оставить только символы lo..hi
+  int         shrink = 1;            // уменьшить в shrink раз
+  Format      format = FMT_RAW;
+};
+
+[[noreturn]] void fail(const std::string &msg)
+{
+  throw std::runtime_error(msg);
+}
+
+std::string readfile(const std::string &path)
+{
+  std::ifstream in(path, std::ios::binary);
+  if (!in) fail("не открыть " + path);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+uint32_t le32(const std::string &d, size_t at)
+{
+  if (at + 4 > d.size()) fail("RHF: файл обрезан");
+  return (uint8_t)d[at] | (uint8_t)d[at + 1] << 8 | (uint8_t)d[at + 2] << 16 | (uint32_t)(uint8_t)d[at + 3] << 24;
+}
+
+// .RHF (matrixFont): название - паскалевская строка в начале, по 0x120 - первый символ,
+// число символов, ширина, высота (uint32), с 0x1B0 - точки всех символов сплошным
+// потоком бит, младший бит байта первый
+Font load_rhf(const std::string &path)
+{
+  const std::string d = readfile(path);
+  Font f;
+  if (d.empty()) fail("RHF: пустой файл");
+  f.title  = d.substr(1, (uint8_t)d[0]);
+  int first = le32(d, 0x120), count = le32(d, 0x124);
+  f.width  = le32(d, 0x128);
+  f.height = le32(d, 0x12C);
+  size_t bit = 0x1B0 * 8, n = (size_t)f.width * f.height;
+  if (0x1B0 + (count * n + 7) / 8 > d.size()) fail("RHF: файл обрезан");
+  for (int c = 0; c < count; c++) {
+    Glyph g(n);
+    for (size_t i = 0; i < n; i++, bit++) g[i] = ((uint8_t)d[bit >> 3] >> (bit & 7)) & 1;
+    f.codes.push_back(first + c);
+    f.glyphs.push_back(g);
+  }
+  return f;
+}
+
+// числа массива name (или первого массива) из текста .h, комментарии пропускаются,
+// ST7735_NOGLYPH - -1
+std::vector<long> parse_array(const std::string &text, const std::string &name, size_t *open)
+{
+  std::regex  decl(name.empty() ? std::string(R"((\w+)\s*\[[^\]]*\][^=;]*=\s*\{)")
+                                : "(" + name + R"()\s*\[[^\]]*\][^=;]*=\s*\{)");
+  std::smatch m;
+  if (!std::regex_search(text, m, decl)) fail("нет массива " + name);
+  size_t at = m.position(0) + m.length(0), end = text.find("};", at);
+  if (end == std::string::npos) fail("массив не закрыт");
+  *open = at;
+  std::vector<long> out;
+  for (size_t i = at; i < end; i++) {
+    if (text.compare(i, 2, "//") == 0) { i = text.find('\n', i); if (i == std::string::npos) break; continue; }
+    if (text.compare(i, 2, "/*") == 0) { i = text.find("*/", i) + 1; continue; }
+    if (text.compare(i, 14, "ST7735_NOGLYPH") == 0) { out.push_back(-1); i += 13; continue; }
+    if (isdigit((unsigned char)text[i]) && (i == 0 || !isalnum((unsigned char)text[i - 1]))) {
+      char *e;
+      out.push_back(strtoul(text.c_str() + i, &e, 0));
+      i = e - text.c_str() - 1;
+    }
+  }
+  return out;
+}
+
+int define_int(const std::string &text, const std::string &suffix)
+{
+  std::smatch m;
+  if (!std::regex_search(text, m, std::regex("#define\\s+FONT_\\w+_" + suffix + "\\s+(\\d+)"))) return -1;
+  return std::stoi(m[1]);
+}
+
+// точка (x, y) символа из матрицы в порядке bits
+uint8_t pixel(const uint8_t *g, int w, int h, int x, int y, int bits)
+{
+  if (bits == BITS_VRB) return (g[x * ((h + 7) / 8) + (y >> 3)] >> (y & 7)) & 1;
+  uint8_t b = g[y * ((w + 7) / 8) + (x >> 3)];
+  return bits == BITS_RB ? (b >> (x & 7)) & 1 : (b >> (7 - (x & 7))) & 1;
+}
+
+// .h: описание st7735_font с числами (const st7735_font fd_* = { массив, смещения, ... }),
+// matrixFont (#define FONT_*_START_CHAR ...), UTFT (в начале массива закомментированный
+// заголовок "// 0xW,0xH,0xFIRST,0xCOUNT,") или самодельный массив с размерами из опций
+Font load_header(const std::string &path, const Options &o)
+{
+  const std::string text = readfile(path);
+  Font   f;
+  size_t open;
+  std::vector<long> data = parse_array(text, o.array, &open), offs;
+  std::smatch m;
+  int first = 32, count = -1, bits = BITS_FB;
+  size_t gb;
+
+  f.title = path.substr(path.find_last_of('/') + 1);
+  f.title = f.title.substr(0, f.title.find_last_of('.'));
+  if (std::regex_search(text, m, std::regex(R"(^//\s*(.+?) \(из [^)]*\), )"))) f.title = m[1]; // свой же выход
+  if (std::regex_search(text, m, std::regex(R"re(#include\s*"([^"]*lcd7735sl\.h)")re"))) f.include = m[1];
+  if (o.array.empty() && std::regex_search(text, m, std::regex(
+        R"(st7735_font\s+\w+\s*=\s*\{\s*(\w+)\s*,\s*(\w+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,\s*(\d+)\s*,\s*(BITS_\w+)\s*(,[^}]*)?\})"))) {
+    std::string flags = m[9];
+    if (m[8] == "BITS_FB") bits = BITS_FB;
+    else if (m[8] == "BITS_RB") bits = BITS_RB;
+    else if (m[8] == "BITS_VRB") bits = BITS_VRB;
+    else fail("читаются только матрицы BITS_FB, BITS_RB и BITS_VRB");
+    if (flags.find("ST7735_FONT_BOX") != std::string::npos) fail("шрифт с ST7735_FONT_BOX не читается");
+    std::string remap = m[2];
+    f.width  = std::stoi(m[4]);
+    f.height = std::stoi(m[5]);
+    first    = std::stoi(m[6]);
+    count    = std::stoi(m[7]);
+    data     = parse_array(text, m[1], &open);
+    if (remap != "0") offs = parse_array(text, remap, &open);
+  } else if (define_int(text, "CHAR_WIDTH") > 0) { // matrixFont
+    f.width  = define_int(text, "CHAR_WIDTH");
+    f.height = define_int(text, "CHAR_HEIGHT");
+    first    = define_int(text, "START_CHAR");
+    count    = define_int(text, "LENGTH");
+    // развёртка по столбцам видна по формуле длины массива
+    bits = std::regex_search(text, std::regex(R"(ARRAY_LENGTH\s+\([^)]*CHAR_WIDTH)")) ? BITS_VRB : BITS_RB;
+    if (std::regex_search(text, m, std::regex(R"(//\s*Название шрифта\s+([^\r\n]+))"))) f.title = m[1];
+  } else if (std::regex_search(text.cbegin() + open, text.cend(), m,
+               std::regex(R"(^\s*//\s*0x([0-9A-Fa-f]{2}),\s*0x([0-9A-Fa-f]{2}),\s*0x([0-9A-Fa-f]{2}),\s*0x([0-9A-Fa-f]{2}))"))) { // UTFT
+    f.width  = std::stoi(m[1], nullptr, 16);
+    f.height = std::stoi(m[2], nullptr, 16);
+    first    = std::stoi(m[3], nullptr, 16);
+    count    = std::stoi(m[4], nullptr, 16);
+  }
+  if (o.width)      f.width  = o.width;
+  if (o.height)     f.height = o.height;
+  if (o.first >= 0) first    = o.first;
+  if (o.bits >= 0)  bits     = o.bits;
+  if (f.width <= 0 || f.height <= 0) fail("размер символа неизвестен, нужен -s WxH");
+
+  gb = bits == BITS_VRB ? (size_t)f.width * ((f.height + 7) / 8) : (size_t)f.height * ((f.width + 7) / 8);
+  if (count < 0) count = data.size() / gb;
+  if (!o.map.empty()) count = o.map.size();
+  if (offs.empty())
+    for (int c = 0; c < count; c++) offs.push_back(c * gb);
+  if ((size_t)count > offs.size()) fail("смещений меньше, чем символов");
+  std::vector<uint8_t> bytes(data.begin(), data.end());
+  for (int c = 0; c < count; c++) {
+    if (offs[c] < 0) continue; // ST7735_NOGLYPH
+    if (offs[c] + gb > bytes.size()) fail("в массиве меньше символов, чем заявлено");
+    Glyph g((size_t)f.width * f.height);
+    for (int y = 0; y < f.height; y++)
+      for (int x = 0; x < f.width; x++) g[y * f.width + x] = pixel(&bytes[offs[c]], f.width, f.height, x, y, bits);
+    f.codes.push_back(o.map.empty() ? first + c : (uint8_t)o.map[c]);
+    f.glyphs.push_back(g);
+  }
+  return f;
+}
+
+// уменьшение в k раз: точка - сумма точек квадрата k x k (у правого и нижнего края - неполного)
+void shrink(Font &f, int k)
+{
+  int w = (f.width + k - 1) / k, h = (f.height + k - 1) / k;
+  for (Glyph &g : f.glyphs) {
+    Glyph s((size_t)w * h, 0);
+    for (int y = 0; y < f.height; y++)
+      for (int x = 0; x < f.width; x++) s[(y / k) * w + x / k] += g[y * f.width + x];
+    g = s;
+  }
+  f.width  = w;
+  f.height = h;
+  f.max   *= k * k;
+}
+
+// однобитные форматы: точка закрашена, если закрашено не меньше половины её квадрата
+Font mono(const Font &f)
+{
+  Font m = f;
+  for (Glyph &g : m.glyphs)
+    for (uint8_t &v : g) v = 2 * v >= f.max;
+  m.max = 1;
+  return m;
+}
+
+// строки точек x0..x0+w-1, y0..y0+h-1 в байты BITS_RB
+void pack_rb(const Glyph &g, int width, int x0, int y0, int w, int h, std::vector<uint8_t> &out)
+{
+  for (int y = y0; y < y0 + h; y++)
+    for (int x = 0; x < w; x += 8) {
+      uint8_t b = 0;
+      for (int k = 0; k < 8 && x + k < w; k++) b |= g[y * width + x0 + x + k] << k;
+      out.push_back(b);
+    }
+}
+
+// BITS_G2/BITS_G4: строки по bpp бит на точку, левая точка в старших битах, строка - до целого байта.
+// Уровень 0..max переводится в 0..(1 << bpp) - 1 с округлением
+void pack_gray(const Glyph &g, int w, int h, int max, int bpp, std::vector<uint8_t> &out)
+{
+  int top = (1 << bpp) - 1;
+  for (int y = 0; y < h; y++)
+    for (int x = 0; x < w; x += 8 / bpp) {
+      uint8_t b = 0;
+      for (int k = 0; k < 8 / bpp; k++) {
+        int l = x + k < w ? (g[y * w + x + k] * top + max / 2) / max : 0;
+        b |= l << (8 - bpp * (k + 1));
+      }
+      out.push_back(b);
+    }
+}
+
+// BITS_BOX: {x, y, ширина, высота} рамки изображения, затем точки внутри неё
+std::vector<uint8_t> encode_box(const Glyph &g, int w, int h)
+{
+  int x0 = w, y0 = h, x1 = -1, y1 = -1;
+  for (int y = 0; y < h; y++)
+    for (int x = 0; x < w; x++)
+      if (g[y * w + x]) { x0 = std::min(x0, x); x1 = std::max(x1, x); y0 = std::min(y0, y); y1 = std::max(y1, y); }
+  if (x1 < 0) return { 0, 0, 0, 0 };
+  std::vector<uint8_t> out = { (uint8_t)x0, (uint8_t)y0, (uint8_t)(x1 - x0 + 1), (uint8_t)(y1 - y0 + 1) };
+  pack_rb(g, w, x0, y0, x1 - x0 + 1, y1 - y0 + 1, out);
+  return out;
+}
+
+// BITS_RLE: байт (фон << 4) | цвет, фон 15 - к нему прибавляется следующий байт
+std::vector<uint8_t> encode_rle(const Glyph &g)
+{
+  std::vector<uint8_t> out;
+  size_t i = 0, n = g.size();
+  while (i < n) {
+    size_t bg = 0, fg = 0;
+    while (i < n && !g[i]) { bg++; i++; }
+    while (i < n && g[i])  { fg++; i++; }
+    while (bg > 15 + 255) { out.push_back(0xF0); out.push_back(255); bg -= 15 + 255; }
+    size_t first = std::min<size_t>(fg, 15);
+    if (bg >= 15) { out.push_back(0xF0 | first); out.push_back(bg - 15); }
+    else            out.push_back(bg << 4 | first);
+    for (fg -= first; fg; fg -= std::min<size_t>(fg, 15)) out.push_back(std::min<size_t>(fg, 15));
+  }
+  return out;
+}
+
+// символ кода c (cp1251) в UTF-8 для комментария, непечатаемые - пусто
+std::string cp1251(int c)
+{
+  static const uint16_t hi[64] = {
+    0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021, 0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+    0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014, 0,      0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+    0,      0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7, 0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0,      0x00AE, 0x0407,
+    0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7, 0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457,
+  };
+  unsigned u = c < 0x20 || c == 0x7F ? 0 : c < 0x80 ? c : c < 0xC0 ? hi[c - 0x80] : 0x0410 + c - 0xC0;
+  std::string s;
+  if (u >= 0x800)     s = { char(0xE0 | u >> 12), char(0x80 | (u >> 6 & 0x3F)), char(0x80 | (u & 0x3F)) };
+  else if (u >= 0x80) s = { char(0xC0 | u >> 6), char(0x80 | (u & 0x3F)) };
+  else if (u)         s = { char(u) };
+  return s;
+}
+
+std::string upper(std::string s)
+{
+  for (char &c : s) c = toupper((unsigned char)c);
+  return s;
+}
+
+void write_header(FILE *out, const Font &font, const Options &o, const std::string &src)
+{
+  bool gray = o.format == FMT_G2 || o.format == FMT_G4;
+  int  bpp  = o.format == FMT_G4 ? 4 : o.format == FMT_G2 ? 2 : 1;
+  const Font f = gray ? font : mono(font);
+  // оставляем символы lo..hi, из повторяющихся кодов - первый
+  std::vector<const Glyph *> slot(256, nullptr);
+  for (size_t i = 0; i < f.codes.size(); i++)
+    if (f.codes[i] >= o.lo && f.codes[i] <= o.hi && !slot[f.codes[i]]) slot[f.codes[i]] = &f.glyphs[i];
+  int first = 0, last = 255;
+  while (first < 256 && !slot[first]) first++;
+  while (last >= 0 && !slot[last]) last--;
+  if (first > last) fail("нет ни одного символа");
+  int  count = last - first + 1;
+  bool dense = true;
+  for (int c = first; c <= last; c++) dense = dense && slot[c];
+  bool raw = o.format == FMT_RAW || gray; // матрицы одной длины
+  bool idx = !raw || !dense; // смещения нужны для матриц разной длины и для дыр
+
+  std::vector<std::vector<uint8_t>> data(count);
+  size_t total = 0, gb = (size_t)f.height * ((f.width * bpp + 7) / 8);
+  std::vector<long> offs(count, -1);
+  for (int c = 0; c < count; c++) {
+    const Glyph *g = slot[first + c];
+    if (!g) continue;
+    if (o.format == FMT_RAW) pack_rb(*g, f.width, 0, 0, f.width, f.height, data[c]);
+    if (o.format == FMT_BOX) data[c] = encode_box(*g, f.width, f.height);
+    if (o.format == FMT_RLE) data[c] = encode_rle(*g);
+    if (gray)                pack_gray(*g, f.width, f.height, f.max, bpp, data[c]);
+    offs[c] = total;
+    total  += data[c].size();
+  }
+  if (idx && total > 0xFFFE) fail("шрифт больше 64 КБ - смещения не влезут в uint16_t");
+
+  static const char *about[] = {
+    "матрицы построчно, младший бит - левая точка (BITS_RB)",
+    "матрицы обрезаны по рамке изображения (ST7735_FONT_BOX):\n"
+    "// у каждого символа 4 байта рамки {x, y, ширина, высота}, затем только точки внутри рамки",
+    "сжатый формат BITS_RLE: для каждого символа\n"
+    "// пары отрезков фон/цвет построчно подряд, см. print_char_rle() в lcd7735sl.c",
+    "сглаженный, 2 бита на точку (BITS_G2)",
+    "сглаженный, 4 бита на точку (BITS_G4)",
+  };
+  const std::string guard = "FONT_" + upper(o.name) + "_H";
+  fprintf(out, "// %s (из %s), %s\n", f.title.c_str(), src.c_str(), about[o.format]);
+  fprintf(out, "// %zu байт матриц", total);
+  if (idx) fprintf(out, " + %d байт смещений вместо %zu", 2 * count, gb * count);
+  fprintf(out, ", сгенерировано tools/fontc\n");
+  fprintf(out, "\n#ifndef %s\n#define %s\n\n#include \"%s\"\n\n", guard.c_str(), guard.c_str(), f.include.c_str());
+
+  fprintf(out, "const unsigned char font_%s[%zu] =\n{\n", o.name.c_str(), total);
+  int end = count;
+  while (end && data[end - 1].empty()) end--; // после последней матрицы запятой нет
+  for (int c = 0; c < end; c++) {
+    if (data[c].empty()) continue;
+    fprintf(out, "   ");
+    for (size_t i = 0; i < data[c].size(); i++) fprintf(out, " 0x%02X%s", data[c][i], i + 1 < data[c].size() ? "," : "");
+    fprintf(out, "%s  // Символ %d <%s>\n", c + 1 < end ? "," : " ", first + c, cp1251(first + c).c_str());
+  }
+  fprintf(out, "};\n\n");
+
+  if (idx) {
+    fprintf(out, "// смещения матриц символов %d..%d%s\n", first, last, dense ? "" : ", ST7735_NOGLYPH - символа нет");
+    fprintf(out, "const uint16_t font_%sidx[%d] =\n{\n", o.name.c_str(), count);
+    for (int c = 0; c < count; c++) {
+      if (c % 16 == 0) fprintf(out, "   ");
+      if (offs[c] < 0) fprintf(out, " ST7735_NOGLYPH");
+      else             fprintf(out, " %5ld", offs[c]);
+      fprintf(out, "%s", c + 1 < count ? "," : "");
+      if (c % 16 == 15 || c + 1 == count) fprintf(out, "\n");
+    }
+    fprintf(out, "};\n\n");
+  }
+
+  fprintf(out, "// описание шрифта для print_char_font()\n");
+  fprintf(out, "const st7735_font fd_%s = { font_%s, ", o.name.c_str(), o.name.c_str());
+  if (idx) fprintf(out, "font_%sidx, ", o.name.c_str());
+  else     fprintf(out, "0, ");
+  fprintf(out, "%zu, %d, %d, %d, %d, ", raw ? gb : 0, f.width, f.height, first, count);
+  if (o.format == FMT_RAW) fprintf(out, "BITS_RB, 0 };\n");
+  if (o.format == FMT_BOX) fprintf(out, "BITS_RB, ST7735_FONT_BOX };\n");
+  if (o.format == FMT_RLE) fprintf(out, "BITS_RLE, 0 };\n");
+  if (o.format == FMT_G2)  fprintf(out, "BITS_G2, 0 };\n");
+  if (o.format == FMT_G4)  fprintf(out, "BITS_G4, 0 };\n");
+  fprintf(out, "\n#endif // %s\n", guard.c_str());
+}
+
+void usage()
+{
+  fprintf(stderr,
+    "fontc [опции] вход.{RHF,h} > выход.h\n"
+    "  -n ИМЯ         имя в выходе: font_ИМЯ, font_ИМЯidx, fd_ИМЯ (обязательно)\n"
+    "  -o raw|box|rle|g2|g4 формат: матрицы целиком, обрезанные по рамке, сжатые (raw)\n"
+    "                 или сглаженные, 2 или 4 бита на точку\n"
+    "  -x K           уменьшить в K раз (для g2/g4: уровни из квадратов K x K)\n"
+    "  -r A-B         оставить только символы с кодами A..B\n"
+    "для .h без заголовка matrixFont/UTFT:\n"
+    "  -a МАССИВ      имя массива (по умолчанию первый)\n"
+    "  -s WxH         размер символа\n"
+    "  -f КОД         код первого символа (32)\n"
+    "  -m СИМВОЛЫ     коды символов по порядку матриц, вместо -f\n"
+    "  -b fb|rb|vrb   порядок бит: старший бит слева, младший слева, по столбцам (fb)\n");
+  exit(2);
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+  Options     o;
+  std::string in;
+  for (int i = 1; i < argc; i++) {
+    std::string a = argv[i];
+    if (a.size() == 2 && a[0] == '-' && i + 1 < argc) {
+      std::string v = argv[++i];
+      switch (a[1]) {
+      case 'n': o.name  = v; break;
+      case 'a': o.array = v; break;
+      case 'm': o.map   = v; break;
+      case 'f': o.first = std::stoi(v, nullptr, 0); break;
+      case 's': if (sscanf(v.c_str(), "%dx%d", &o.width, &o.height) != 2) usage(); break;
+      case 'r': if (sscanf(v.c_str(), "%d-%d", &o.lo, &o.hi) != 2) usage(); break;
+      case 'b': o.bits   = v == "fb" ? BITS_FB : v == "rb" ? BITS_RB : v == "vrb" ? BITS_VRB : (usage(), 0); break;
+      case 'o': o.format = v == "raw" ? FMT_RAW : v == "box" ? FMT_BOX : v == "rle" ? FMT_RLE :
+                           v == "g2" ? FMT_G2 : v == "g4" ? FMT_G4 : (usage(), FMT_RAW); break;
+      case 'x': o.shrink = std::stoi(v); if (o.shrink < 1 || o.shrink > 15) usage(); break;
+      default:  usage();
+      }
+    } else if (in.empty() && a[0] != '-') in = a;
+    else usage();
+  }
+  if (in.empty() || o.name.empty()) usage();
+
+  try {
+    std::string ext = upper(in.substr(in.find_last_of('.') + 1));
+    Font f = ext == "RHF" ? load_rhf(in) : load_header(in, o);
+    if (o.shrink > 1) shrink(f, o.shrink);
+    write_header(stdout, f, o, in.substr(in.find_last_of('/') + 1));
+  } catch (const std::exception &e) {
+    fprintf(stderr, "fontc: %s\n", e.what());
+    return 1;
+  }
+  return 0;
+}
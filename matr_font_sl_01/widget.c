@@ -0,0 +1,250 @@
+#include <string.h>
+#include "widget.h"
+#include "bargraph.h"
+
+// a и b пересекаются
+static uint8_t widget_overlap(const st7735_rect *a, const st7735_rect *b)
+{
+  return a->x0 <= b->x1 && b->x0 <= a->x1 && a->y0 <= b->y1 && b->y0 <= a->y1;
+}
+
+// a закрывает b целиком
+static uint8_t widget_covers(const st7735_rect *a, const st7735_rect *b)
+{
+  return a->x0 <= b->x0 && a->x1 >= b->x1 && a->y0 <= b->y0 && a->y1 >= b->y1;
+}
+
+// a = прямоугольник, охватывающий a и b
+static void widget_union(st7735_rect *a, const st7735_rect *b)
+{
+  if (b->x0 < a->x0) a->x0 = b->x0;
+  if (b->y0 < a->y0) a->y0 = b->y0;
+  if (b->x1 > a->x1) a->x1 = b->x1;
+  if (b->y1 > a->y1) a->y1 = b->y1;
+}
+
+// добавить прямоугольник к грязной области виджета
+static void widget_mark(widget *w, int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+  st7735_rect r = { x0, y0, x1, y1 };
+  if (w->dirty.x0 > w->dirty.x1) w->dirty = r;
+  else                           widget_union(&w->dirty, &r);
+}
+
+// вернуть виджету грязной его часть области r (r его задевает)
+static void widget_keep(widget *w, const st7735_rect *r)
+{
+  widget_mark(w, (r->x0 > w->rect.x0) ? r->x0 : w->rect.x0, (r->y0 > w->rect.y0) ? r->y0 : w->rect.y0,
+                 (r->x1 < w->rect.x1) ? r->x1 : w->rect.x1, (r->y1 < w->rect.y1) ? r->y1 : w->rect.y1);
+}
+
+static void widget_place(widget *w, uint8_t type, unsigned char X, unsigned char Y, uint16_t W, uint16_t H,
+                         uint16_t fcolor, uint16_t bcolor)
+{
+  w->type    = type;
+  w->rect.x0 = X;
+  w->rect.y0 = Y;
+  w->rect.x1 = X + W - 1;
+  w->rect.y1 = Y + H - 1;
+  w->font    = 0;
+  w->value   = 0;
+  w->max     = 1;
+  w->fcolor  = fcolor;
+  w->bcolor  = bcolor;
+  w->len     = 0;
+  memset(w->text, 0, sizeof(w->text)); // widget_text() сравнивает все знакоместа
+  widget_invalidate(w);
+}
+
+// новая строка надписи: помечаются только знакоместа, где она отличается от выведенной
+static void widget_text(widget *w, const char *str)
+{
+  unsigned char i, a, b, end = 0, first = 255, last = 0;
+  for (i = 0; i < w->len; i++) {
+    a = end ? 0 : (unsigned char)str[i];
+    if (!a) end = 1;
+    b = (unsigned char)w->text[i];
+    if (a != b) {
+      if (first == 255) first = i;
+      last = i;
+    }
+    w->text[i] = a;
+    if (!a && !b) break; // дальше обе строки кончились
+  }
+  w->text[w->len] = 0;
+  if (first != 255)
+    widget_mark(w, w->rect.x0 + first * w->font->width, w->rect.y0,
+                   w->rect.x0 + (last + 1) * w->font->width - 1, w->rect.y1);
+}
+
+// число, прижатое вправо в len знакоместах
+static void widget_format(char *buf, int32_t value, unsigned char len)
+{
+  uint32_t v = (value < 0) ? -(uint32_t)value : (uint32_t)value;
+  unsigned char i = len;
+
+  buf[len] = 0;
+  do {
+    if (i == 0) break;
+    buf[--i] = '0' + v % 10;
+    v /= 10;
+  } while (v);
+  if (value < 0) {
+    if (i == 0) v = 1; // под минус места нет
+    else        buf[--i] = '-';
+  }
+  if (v) i = len; // переполнение
+  while (i) buf[--i] = v ? '-' : ' ';
+}
+
+// WG_BAR - сплошная полоса bargraph во весь прямоугольник: уровень и заливка общие с bargraph.c
+static void widget_bargraph(const widget *w, bargraph *b)
+{
+  bargraph_init(b, w->rect.x0, w->rect.y0, w->rect.x1 - w->rect.x0 + 1, w->rect.y1 - w->rect.y0 + 1, 0,
+                w->max, w->fcolor, w->bcolor, w->bcolor);
+}
+
+void widget_label(widget *w, const st7735_font *f, unsigned char X, unsigned char Y, unsigned char len,
+                  uint16_t fcolor, uint16_t bcolor)
+{
+  if (len > WG_TEXT - 1) len = WG_TEXT - 1;
+  widget_place(w, WG_LABEL, X, Y, len * f->width, f->height, fcolor, bcolor);
+  w->font = f;
+  w->len  = len;
+}
+
+void widget_value(widget *w, const st7735_font *f, unsigned char X, unsigned char Y, unsigned char len,
+                  uint16_t fcolor, uint16_t bcolor)
+{
+  widget_label(w, f, X, Y, len, fcolor, bcolor);
+  w->type = WG_VALUE;
+  widget_format(w->text, 0, w->len);
+}
+
+void widget_bar(widget *w, unsigned char X, unsigned char Y, unsigned char W, unsigned char H, int32_t max,
+                uint16_t fcolor, uint16_t bcolor)
+{
+  widget_place(w, WG_BAR, X, Y, W, H, fcolor, bcolor);
+  w->max = (max > 0) ? max : 1;
+}
+
+void widget_icon(widget *w, const st7735_font *f, unsigned char ch, unsigned char X, unsigned char Y,
+                 uint16_t fcolor, uint16_t bcolor)
+{
+  widget_place(w, WG_ICON, X, Y, f->width, f->height, fcolor, bcolor);
+  w->font = f;
+  w->len  = ch;
+}
+
+void widget_settext(widget *w, const char *str)
+{
+  if (w->type == WG_LABEL) widget_text(w, str);
+}
+
+void widget_setvalue(widget *w, int32_t value)
+{
+  char buf[WG_TEXT];
+  bargraph bar;
+  int16_t a, b;
+
+  if (w->type == WG_VALUE) {
+    if (value == w->value) return;
+    w->value = value;
+    widget_format(buf, value, w->len);
+    widget_text(w, buf);
+  } else if (w->type == WG_BAR) {
+    if (value < 0)      value = 0;
+    if (value > w->max) value = w->max;
+    widget_bargraph(w, &bar);
+    a = bargraph_level(&bar, w->value);
+    b = bargraph_level(&bar, value);
+    w->value = value;
+    if (a == b) return; // на экране та же полоса
+    // перерисовать только разницу между старым и новым краем
+    if (a > b) { int16_t t = a; a = b; b = t; }
+    widget_mark(w, w->rect.x0 + a, w->rect.y0, w->rect.x0 + b - 1, w->rect.y1);
+  }
+}
+
+void widget_seticon(widget *w, unsigned char ch)
+{
+  if (w->type != WG_ICON || w->len == ch) return;
+  w->len = ch;
+  widget_invalidate(w);
+}
+
+void widget_colors(widget *w, uint16_t fcolor, uint16_t bcolor)
+{
+  if (w->fcolor == fcolor && w->bcolor == bcolor) return;
+  w->fcolor = fcolor;
+  w->bcolor = bcolor;
+  widget_invalidate(w);
+}
+
+void widget_invalidate(widget *w)
+{
+  w->dirty = w->rect;
+}
+
+// вывод виджета целиком, лишнее отсекается текущей областью
+static void widget_draw(const widget *w)
+{
+  bargraph bar;
+  switch (w->type) {
+  case WG_LABEL:
+  case WG_VALUE: // за концом строки и на месте неизвестных символов - фон
+    print_string_window(w->font, w->text, w->rect.x0, w->rect.y0, w->rect.x1 - w->rect.x0 + 1, 0,
+                        w->fcolor, w->bcolor);
+    break;
+  case WG_BAR: // bargraph ещё не рисовалась - выводится вся
+    widget_bargraph(w, &bar);
+    bargraph_set(&bar, w->value);
+    break;
+  case WG_ICON:
+    print_char_font(w->font, w->len, w->rect.x0, w->rect.y0, w->fcolor, w->bcolor);
+    break;
+  }
+}
+
+unsigned char widget_flush(widget *ws, unsigned char count, uint16_t bcolor)
+{
+  st7735_rect   reg[WG_REGIONS], r;
+  unsigned char n = 0, drawn = 0, i, j, first;
+
+  // грязные прямоугольники в области: пересекающиеся сливаются (общая часть иначе ушла бы
+  // в SPI дважды), не хватило места - область сливается с первой попавшейся
+  for (i = 0; i < count; i++) {
+    if (ws[i].dirty.x0 > ws[i].dirty.x1) continue;
+    r = ws[i].dirty;
+    ws[i].dirty.x0 = 1;
+    ws[i].dirty.x1 = 0;
+    j = 0;
+    while (j < n) {
+      if (n == WG_REGIONS || widget_overlap(&reg[j], &r)) {
+        widget_union(&r, &reg[j]);
+        reg[j] = reg[--n];
+        j = 0; // выросшая область могла задеть уже проверенные
+      } else j++;
+    }
+    reg[n++] = r;
+  }
+
+  for (j = 0; j < n; j++) {
+    // верхний виджет, закрывающий область целиком: всё, что под ним, всё равно не видно
+    for (first = count; first && !widget_covers(&ws[first - 1].rect, &reg[j]); first--);
+    // стек областей полон: без отсечения виджеты затёрли бы соседей - область остаётся грязной
+    // до следующего widget_flush()
+    if (!st7735clip_push(reg[j].x0, reg[j].y0, reg[j].x1, reg[j].y1)) {
+      for (i = 0; i < count; i++)
+        if (widget_overlap(&ws[i].rect, &reg[j])) widget_keep(&ws[i], &reg[j]);
+      continue;
+    }
+    if (first) first--;
+    else       st7735fillrect(reg[j].x0, reg[j].y0, reg[j].x1, reg[j].y1, bcolor); // где-то виджетов нет
+    for (i = first; i < count; i++)
+      if (widget_overlap(&ws[i].rect, &reg[j])) widget_draw(&ws[i]);
+    st7735clip_pop();
+    drawn++;
+  }
+  return drawn;
+}
@@ -0,0 +1,59 @@
+#pragma once
+#ifndef __WIDGET_H__
+#define __WIDGET_H__
+#include "lcd7735sl.h"
+
+// Виджеты с сохранённым состоянием: надпись, число, полоса, значок. Виджет помнит, что уже
+// выведено, и при смене свойства помечает грязным только изменившийся прямоугольник (у текста -
+// отличающиеся знакоместа, у полосы - разницу уровней). widget_flush() объединяет грязные
+// прямоугольники всех виджетов в области и перерисовывает только их, отсекая вывод по области.
+// Виджеты лежат в массиве, следующий рисуется поверх предыдущего; каждый закрашивает свой
+// прямоугольник целиком.
+
+#define WG_LABEL 0 // строка шрифтом без BITS_RLE и ST7735_FONT_BOX (как print_string_window)
+#define WG_VALUE 1 // целое число, прижатое вправо, тем же выводом
+#define WG_BAR   2 // горизонтальная полоса уровня value из max (max - любое положительное)
+#define WG_ICON  3 // символ любого шрифта (print_char_font)
+
+#ifndef WG_TEXT
+#define WG_TEXT  12 // знакомест в надписи не больше (с нулём в конце): int32_t со знаком
+#endif
+#ifndef WG_REGIONS
+#define WG_REGIONS 4 // грязных областей за один widget_flush(), лишние сливаются
+#endif
+
+typedef struct {
+  st7735_rect        rect;   // место на экране
+  st7735_rect        dirty;  // что перерисовать, x0 > x1 - ничего
+  const st7735_font *font;   // WG_LABEL, WG_VALUE, WG_ICON
+  int32_t            value;  // WG_VALUE: число; WG_BAR: уровень
+  int32_t            max;    // WG_BAR: уровень полной полосы
+  uint16_t           fcolor, bcolor;
+  uint8_t            type;   // WG_*
+  uint8_t            len;    // WG_LABEL, WG_VALUE: знакомест; WG_ICON: код символа
+  char               text[WG_TEXT]; // WG_LABEL, WG_VALUE: выведенная строка
+} widget;
+
+void widget_label(widget *w, const st7735_font *f, unsigned char X, unsigned char Y, unsigned char len,
+                  uint16_t fcolor, uint16_t bcolor);
+void widget_value(widget *w, const st7735_font *f, unsigned char X, unsigned char Y, unsigned char len,
+                  uint16_t fcolor, uint16_t bcolor);
+void widget_bar(widget *w, unsigned char X, unsigned char Y, unsigned char W, unsigned char H, int32_t max,
+                uint16_t fcolor, uint16_t bcolor);
+void widget_icon(widget *w, const st7735_font *f, unsigned char ch, unsigned char X, unsigned char Y,
+                 uint16_t fcolor, uint16_t bcolor);
+
+// смена свойств: если ничего не изменилось - виджет не помечается
+void widget_settext(widget *w, const char *str);   // WG_LABEL, лишнее обрезается
+void widget_setvalue(widget *w, int32_t value);    // WG_VALUE (не влезает - '-' во всех знакоместах), WG_BAR
+void widget_seticon(widget *w, unsigned char ch);  // WG_ICON
+void widget_colors(widget *w, uint16_t fcolor, uint16_t bcolor);
+// пометить виджет целиком (после st7735init или очистки экрана)
+void widget_invalidate(widget *w);
+
+// перерисовать грязное у count виджетов массива ws, bcolor - фон экрана там, где виджетов нет.
+// Возвращает число перерисованных областей; если стек st7735clip_push() полон, область
+// не рисуется и остаётся грязной
+unsigned char widget_flush(widget *ws, unsigned char count, uint16_t bcolor);
+
+#endif // __WIDGET_H__